@@ -4,11 +4,16 @@ pinCfgC Config Tool Builder
 Combines separate HTML, CSS, and JavaScript files into a single HTML file.
 Automatically extracts V_TYPES and S_TYPES from MySensors header.
 Also extracts CLI commands from Cli.c and error codes from MyTransportErrors.h.
+Compiles the library's parser to WebAssembly when emscripten is available.
 """
 
+import glob
 import os
+import shutil
+import subprocess
 import sys
 import re
+import tempfile
 
 def read_file(filepath):
     """Read file contents."""
@@ -524,6 +529,76 @@ const V_TYPES = {
     '99': 'V_CUSTOM - Custom'
 };"""
 
+# Flags of the parser build - static arena like the nodes, all measurement types, hardware from the test mocks.
+# wasm32 is a 32-bit target with the non-AVR defaults, the memory figure is the one of an ARM or ESP node.
+PARSER_WASM_FLAGS = [
+    '-O2',
+    '-DUNIT_TEST',
+    '-DPINCFG_USE_ERROR_MESSAGES',
+    '-DPINCFG_FEATURE_I2C_MEASUREMENT',
+    '-DPINCFG_FEATURE_SPI_MEASUREMENT',
+    '-DPINCFG_FEATURE_LOOPTIME_MEASUREMENT',
+    '-DPINCFG_FEATURE_ANALOG_MEASUREMENT',
+]
+PARSER_WASM_EXPORTS = ['_PinCfgWasm_iValidate', '_PinCfgWasm_u32MemoryRequired', '_PinCfgWasm_pcOutput']
+
+def generate_fallback_parser():
+    """Parser placeholder if emscripten is not available, the tool validates in JavaScript only."""
+    return """// pinCfgC parser (WebAssembly) - not built
+var createPinCfgParser = null;"""
+
+def build_parser_wasm(script_dir):
+    """Compile the library's parser to WebAssembly with emscripten, returns the JS module with the wasm inlined."""
+    emcc = os.environ.get('EMCC') or shutil.which('emcc')
+    empp = os.environ.get('EMXX') or shutil.which('em++')
+    if not emcc or not empp:
+        print("Warning: emcc/em++ not found, the tool validates in JavaScript only")
+        return generate_fallback_parser()
+
+    root_dir = os.path.join(script_dir, '..', '..')
+    includes = [
+        '-I' + os.path.join(root_dir, 'include'),
+        '-I' + os.path.join(root_dir, 'test', 'mocks'),
+        '-I' + os.path.join(root_dir, 'src'),
+    ]
+    sources = sorted(glob.glob(os.path.join(root_dir, 'src', '*.c')))
+    sources += sorted(glob.glob(os.path.join(root_dir, 'src', '*.cpp')))
+    sources += sorted(glob.glob(os.path.join(root_dir, 'test', 'mocks', '*.c')))
+    sources += sorted(glob.glob(os.path.join(root_dir, 'test', 'mocks', '*.cpp')))
+    sources.append(os.path.join(script_dir, 'config-tool-wasm.c'))
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        try:
+            objects = []
+            for source in sources:
+                name = os.path.splitext(os.path.basename(source))[0]
+                obj = os.path.join(build_dir, name + ('.cpp.o' if source.endswith('.cpp') else '.o'))
+                compiler = empp if source.endswith('.cpp') else emcc
+                subprocess.run(
+                    [compiler] + PARSER_WASM_FLAGS + includes + ['-c', source, '-o', obj],
+                    check=True, capture_output=True, text=True)
+                objects.append(obj)
+
+            output = os.path.join(build_dir, 'pincfg-parser.js')
+            subprocess.run(
+                [empp, '-O2'] + objects + [
+                    '-sMODULARIZE=1',
+                    '-sEXPORT_NAME=createPinCfgParser',
+                    '-sSINGLE_FILE=1',
+                    '-sENVIRONMENT=web',
+                    '-sEXPORTED_FUNCTIONS=' + ','.join(PARSER_WASM_EXPORTS),
+                    '-sEXPORTED_RUNTIME_METHODS=ccall,UTF8ToString',
+                    '-o', output],
+                check=True, capture_output=True, text=True)
+        except subprocess.CalledProcessError as e:
+            print(f"Warning: parser build failed, the tool validates in JavaScript only:\n{e.stderr}")
+            return generate_fallback_parser()
+
+        parser_js = read_file(output)
+
+    print(f"  Parser built from {len(sources)} sources ({len(parser_js):,} bytes of JavaScript)")
+    return "// pinCfgC parser (WebAssembly) - auto-generated from the library sources\n" + parser_js
+
 def main():
     # Get script directory (config/src)
     script_dir = os.path.dirname(os.path.abspath(__file__))
@@ -602,6 +677,11 @@ def main():
     error_codes_js = parse_error_codes(errors_header)
     print()
     
+    # Build the parser
+    print("Building parser (WebAssembly)...")
+    parser_js = build_parser_wasm(script_dir)
+    print()
+    
     # Read and combine JavaScript files
     js_content = ""
     for js_file in js_files:
@@ -631,7 +711,7 @@ def main():
                 flags=re.DOTALL
             )
             # Insert generated types, limits, CLI commands, and error codes at the beginning
-            js_part = mysensors_types_js + "\n\n" + pincfg_limits_js + "\n\n" + cli_commands_js + "\n\n" + error_codes_js + "\n\n" + js_part
+            js_part = mysensors_types_js + "\n\n" + pincfg_limits_js + "\n\n" + cli_commands_js + "\n\n" + error_codes_js + "\n\n" + parser_js + "\n\n" + js_part
         
         js_content += js_part + "\n\n"
     
@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+"""
+pinCfgC Static Config Builder
+Turns a CSV config into a C source of const tables for PinCfgCsv_eInitStatic().
+The config is not parsed on the node and no component names are copied to its memory.
+Supports switches (S, SI, ST, SF, SIF, STF), inputs (I), triggers (T) and the global items (CD, CM, CR, CN).
+"""
+
+import os
+import re
+import sys
+
+FIXED_POINT_SCALE = 1000000
+TRIGGER_MULTI = 3
+TRIGGER_ALL = 8
+TRIGGER_A_FORWARD = 3
+TRIGGER_MAX_SWITCHES = 5
+TIMED_SWITCH_MIN_PERIOD_MS = 50
+TIMED_SWITCH_MAX_PERIOD_MS = 600000
+CHILD_IDS_MAX = 255  # PINCFG_CHILD_IDS_MAX_D
+
+SWITCH_MODES = {'S': 0, 'SI': 1, 'ST': 2, 'SF': 0, 'SIF': 1, 'STF': 2}
+GLOBAL_ITEMS = {
+    'CD': ('u32InPinDebounceMs', 0),
+    'CM': ('u32InPinMulticlickMaxDelayMs', 0),
+    'CR': ('u32SwitchImpulseDurationMs', 50),
+    'CN': ('u32SwitchFbDelayMs', 0),
+}
+
+
+class ConfigError(Exception):
+    pass
+
+
+def read_file(filepath):
+    """Read file contents."""
+    try:
+        with open(filepath, 'r', encoding='utf-8') as f:
+            return f.read()
+    except FileNotFoundError:
+        print(f"Error: File not found: {filepath}")
+        sys.exit(1)
+    except Exception as e:
+        print(f"Error reading {filepath}: {e}")
+        sys.exit(1)
+
+
+def write_file(filepath, content):
+    """Write content to file."""
+    try:
+        with open(filepath, 'w', encoding='utf-8') as f:
+            f.write(content)
+        print(f"Successfully created: {filepath}")
+    except Exception as e:
+        print(f"Error writing {filepath}: {e}")
+        sys.exit(1)
+
+
+def parse_uint(text, maximum):
+    """Unsigned number like strtoul with base 0 (0x hex, leading 0 octal)."""
+    if re.fullmatch(r'0[xX][0-9a-fA-F]+', text):
+        value = int(text, 16)
+    elif re.fullmatch(r'0[0-7]+', text):
+        value = int(text, 8)
+    elif re.fullmatch(r'[0-9]+', text):
+        value = int(text, 10)
+    else:
+        raise ConfigError(f"invalid number '{text}'")
+    if value > maximum:
+        raise ConfigError(f"number '{text}' out of range")
+    return value
+
+
+def parse_fixed_point(text):
+    """Decimal to fixed point like PinCfgStr_eAtoFixedPoint(), the fraction is truncated to 6 digits."""
+    match = re.fullmatch(r'(-?)([0-9]*)(?:\.([0-9]*))?', text)
+    if not match or (match.group(2) == '' and match.group(3) is None):
+        raise ConfigError(f"invalid event data '{text}'")
+    integer = int(match.group(2) or '0')
+    fraction = int(((match.group(3) or '')[:6]).ljust(6, '0'))
+    if integer > 2147:
+        raise ConfigError(f"event data '{text}' out of range")
+    value = integer * FIXED_POINT_SCALE + fraction
+    return -value if match.group(1) else value
+
+
+class StaticConfig:
+    def __init__(self):
+        self.switches = []  # (name, id, mode, pin, fb_pin, period)
+        self.inpins = []  # (name, id, pin)
+        self.triggers = []  # (input index, first action, actions count, event type, data, line)
+        self.actions = []  # (switch index, action)
+        self.globals = {}
+        self.next_id = 1  # 0 is the CLI
+        self.switch_idx = {}
+        self.inpin_idx = {}
+
+    def add_presentable(self, name):
+        if '"' in name or '\\' in name:
+            raise ConfigError(f"invalid name '{name}'")
+        if name in self.switch_idx or name in self.inpin_idx:
+            raise ConfigError(f"duplicate name '{name}'")
+        if self.next_id >= CHILD_IDS_MAX:
+            raise ConfigError("too many child ids")
+        self.next_id += 1
+        return self.next_id - 1
+
+    def parse_switch(self, items):
+        kind = items[0]
+        if kind not in SWITCH_MODES:
+            raise ConfigError(f"invalid switch definition '{kind}'")
+        mode = SWITCH_MODES[kind]
+        fields = 2 + (1 if mode == 2 else 0) + (1 if kind.endswith('F') else 0)
+        if len(items) < 3 or (len(items) - 1) % fields != 0:
+            raise ConfigError("invalid switch items")
+        for offset in range(1, len(items), fields):
+            name = items[offset]
+            pin = parse_uint(items[offset + 1], 0xFF)
+            period = 0
+            fb_pin = 0
+            if mode == 2:
+                period = parse_uint(items[offset + 2], 0xFFFFFFFF)
+                if period < TIMED_SWITCH_MIN_PERIOD_MS or period > TIMED_SWITCH_MAX_PERIOD_MS:
+                    raise ConfigError(f"invalid time period of '{name}'")
+            if kind.endswith('F'):
+                fb_pin = parse_uint(items[offset + fields - 1], 0xFF)
+            presentable_id = self.add_presentable(name)
+            self.switch_idx[name] = len(self.switches)
+            self.switches.append((name, presentable_id, mode, pin, fb_pin, period))
+
+    def parse_inpins(self, items):
+        if len(items) < 3 or (len(items) - 1) % 2 != 0:
+            raise ConfigError("invalid input items")
+        for offset in range(1, len(items), 2):
+            name = items[offset]
+            pin = parse_uint(items[offset + 1], 0xFF)
+            if pin < 1:
+                raise ConfigError(f"invalid pin of '{name}'")
+            presentable_id = self.add_presentable(name)
+            self.inpin_idx[name] = len(self.inpins)
+            self.inpins.append((name, presentable_id, pin))
+
+    def parse_trigger(self, items, line):
+        if len(items) < 7 or (len(items) - 5) % 2 != 0:
+            raise ConfigError("invalid trigger items")
+        # like the parser, sources are found among the items of the previous lines
+        if items[2] not in self.inpin_idx:
+            raise ConfigError(f"input '{items[2]}' not found, only inputs publish events in static tables")
+        event_type = parse_uint(items[3], 0xFF)
+        if event_type > TRIGGER_ALL:
+            raise ConfigError("invalid event type")
+        data = parse_fixed_point(items[4])
+        if event_type == TRIGGER_MULTI:
+            data = -(-data // FIXED_POINT_SCALE) if data < 0 else data // FIXED_POINT_SCALE
+        count = (len(items) - 5) // 2
+        if count > TRIGGER_MAX_SWITCHES:
+            raise ConfigError("too many switches")
+        first = len(self.actions)
+        for offset in range(5, len(items), 2):
+            if items[offset] not in self.switch_idx:
+                raise ConfigError(f"switch '{items[offset]}' not found")
+            action = parse_uint(items[offset + 1], 0xFF)
+            if action > TRIGGER_A_FORWARD:
+                raise ConfigError("invalid switch action")
+            self.actions.append((self.switch_idx[items[offset]], action))
+        self.triggers.append((self.inpin_idx[items[2]], first, count, event_type, data, line))
+
+    def parse_global(self, items):
+        if items[0] not in GLOBAL_ITEMS:
+            raise ConfigError(f"invalid global config item '{items[0]}'")
+        field, minimum = GLOBAL_ITEMS[items[0]]
+        value = parse_uint(items[1], 0xFFFFFFFF)
+        if value < minimum:
+            raise ConfigError(f"{items[0]} below {minimum}")
+        self.globals[field] = value
+
+    def parse(self, config):
+        # lines are numbered as the parser does, comments included
+        for line, text in enumerate(config.replace('\r', '').replace('\n', '').split('/')):
+            if text == '' or text.startswith('#'):
+                continue
+            items = text.split(',')
+            try:
+                if len(items) < 2:
+                    raise ConfigError("undefined format")
+                kind = items[0]
+                if kind in ('MS', 'SR', 'TC'):
+                    raise ConfigError(f"'{kind}' lines are not supported in static tables")
+                elif kind.startswith('S'):
+                    self.parse_switch(items)
+                elif kind == 'I':
+                    self.parse_inpins(items)
+                elif kind == 'T':
+                    self.parse_trigger(items, line)
+                elif len(kind) == 2 and kind.startswith('C'):
+                    self.parse_global(items)
+                else:
+                    raise ConfigError(f"unknown type '{kind}'")
+            except ConfigError as e:
+                raise ConfigError(f"line {line} '{text}': {e}")
+
+    def generate(self, symbol, source_name):
+        out = []
+        out.append(f"// Generated by build-static-config.py from {source_name}, do not edit.")
+        out.append('#include "PinCfgStatic.h"')
+        out.append('')
+
+        # names are arrays of their own, a pointer to a string literal would leave the literal in SRAM on AVR
+        def names(prefix, values):
+            for k, n in enumerate(values):
+                out.append(f'static const char {prefix}{k}[] PINCFG_STATIC_ATTR = "{n}";')
+            if values:
+                out.append('')
+            return [f"{prefix}{k}" for k in range(len(values))]
+
+        def table(ctype, name, rows):
+            if not rows:
+                return 'NULL'
+            out.append(f"static const {ctype} {name}[] PINCFG_STATIC_ATTR = {{")
+            out.extend(f"    {{{row}}}," for row in rows)
+            out.append('};')
+            out.append('')
+            return name
+
+        switch_names = names("_acSwitchName", [sw[0] for sw in self.switches])
+        inpin_names = names("_acInPinName", [inp[0] for inp in self.inpins])
+        switches = table(
+            'PINCFG_STATIC_SWITCH_T',
+            "_asSwitches",
+            [
+                f".pcName = {n}, .u32TimedPeriodMs = {p}UL, .u16Id = {i}, .u8Mode = {m}, .u8Pin = {pin}, "
+                f".u8FbPin = {fb}"
+                for n, (_, i, m, pin, fb, p) in zip(switch_names, self.switches)
+            ])
+        inpins = table(
+            'PINCFG_STATIC_INPIN_T',
+            "_asInPins",
+            [f".pcName = {n}, .u16Id = {i}, .u8Pin = {pin}" for n, (_, i, pin) in zip(inpin_names, self.inpins)])
+        actions = table(
+            'PINCFG_STATIC_SWITCHACTION_T',
+            "_asActions",
+            [f".u16Switch = {s}, .u8Action = {a}" for (s, a) in self.actions])
+        triggers = table(
+            'PINCFG_STATIC_TRIGGER_T',
+            "_asTriggers",
+            [
+                f".i32EventData = {d}L, .u16InPin = {inp}, .u16FirstAction = {f}, .u16Line = {ln}, "
+                f".u8ActionsCount = {c}, .u8EventType = {e}"
+                for (inp, f, c, e, d, ln) in self.triggers
+            ])
+
+        out.append(f"const PINCFG_STATIC_CFG_T {symbol} PINCFG_STATIC_ATTR = {{")
+        out.append(f"    .pasSwitches = {switches},")
+        out.append(f"    .pasInPins = {inpins},")
+        out.append(f"    .pasTriggers = {triggers},")
+        out.append(f"    .pasActions = {actions},")
+        for field, _ in GLOBAL_ITEMS.values():
+            value = f"{self.globals[field]}UL" if field in self.globals else 'PINCFG_STATIC_DEFAULT'
+            out.append(f"    .{field} = {value},")
+        out.append(f"    .u16SwitchesCount = {len(self.switches)},")
+        out.append(f"    .u16InPinsCount = {len(self.inpins)},")
+        out.append(f"    .u16TriggersCount = {len(self.triggers)},")
+        out.append(f"    .u16ActionsCount = {len(self.actions)}}};")
+        out.append('')
+        return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) < 3:
+        print("Usage: build-static-config.py <config.csv> <output.c> [symbol]")
+        print("Writes 'const PINCFG_STATIC_CFG_T <symbol>' (default sPinCfgStatic) for PinCfgCsv_eInitStatic().")
+        sys.exit(1)
+
+    input_path = sys.argv[1]
+    output_path = sys.argv[2]
+    symbol = sys.argv[3] if len(sys.argv) > 3 else 'sPinCfgStatic'
+    if not re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', symbol):
+        print(f"Error: Invalid symbol name: {symbol}")
+        sys.exit(1)
+
+    cfg = StaticConfig()
+    try:
+        cfg.parse(read_file(input_path))
+    except ConfigError as e:
+        print(f"Error: {input_path}: {e}")
+        sys.exit(1)
+
+    write_file(output_path, cfg.generate(symbol, os.path.basename(input_path)))
+    print(f"  {len(cfg.switches)} switches, {len(cfg.inpins)} inputs, {len(cfg.triggers)} triggers")
+
+
+if __name__ == "__main__":
+    main()
@@ -76,6 +76,7 @@ document.addEventListener('DOMContentLoaded', function() {
     setupEventListeners();
     loadFromLocalStorage();
     updateSectionVisibility();
+    initPinCfgParser();
 });
 
 async function initializeAuthPassword() {
@@ -258,6 +258,69 @@ function generate18CharLines(config) {
     });
 }
 
+// Parser compiled from the library sources by build-config-tool.py, null without emscripten
+let pinCfgParser = null;
+
+// PINCFG_RESULT_T
+const PINCFG_RESULTS = [
+    'OK', 'NULLPTR_ERROR', 'IF_NULLPTR_ERROR', 'INVALID_FORMAT', 'MAXLEN_ERROR',
+    'TYPE_ERROR', 'OUTOFMEMORY_ERROR', 'MEMORYINIT_ERROR', 'ERROR', 'WARNINGS'
+];
+
+async function initPinCfgParser() {
+    if (typeof createPinCfgParser !== 'function') {
+        return;
+    }
+    try {
+        pinCfgParser = await createPinCfgParser();
+    } catch (err) {
+        console.warn('pinCfgC parser not loaded, validating in JavaScript only:', err);
+    }
+}
+
+// PinCfgCsv_eValidate() on the config as it is uploaded
+function validateWithParser(config) {
+    const result = pinCfgParser.ccall('PinCfgWasm_iValidate', 'number', ['string'], [config]);
+    const memoryRequired = pinCfgParser.ccall('PinCfgWasm_u32MemoryRequired', 'number', [], []) >>> 0;
+    const output = pinCfgParser.UTF8ToString(pinCfgParser.ccall('PinCfgWasm_pcOutput', 'number', [], []));
+    return {
+        result,
+        memoryRequired,
+        lines: output.split('\n').map(l => l.trim()).filter(l => l)
+    };
+}
+
+function escapeHtml(text) {
+    return text.replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+}
+
+function showParserValidation(validation) {
+    const resultsDiv = document.getElementById('validationResults');
+    const resultName = PINCFG_RESULTS[validation.result] || `${validation.result}`;
+    const diagnostics = validation.lines.filter(l => !l.startsWith('I:'));
+    let html;
+    
+    if (validation.result === 0) {
+        resultsDiv.className = 'validation-results success';
+        html = '<h4>✓ Validation Passed</h4><p>Configuration is valid!</p>';
+    } else {
+        resultsDiv.className = 'validation-results error';
+        html = `<h4>⚠ Validation Issues (${resultName})</h4>`;
+    }
+    html += `<p>Memory required on a 32-bit node (ARM, ESP): <strong>${validation.memoryRequired} bytes</strong>` +
+        ' (AVR nodes need less)</p>';
+    
+    if (diagnostics.length > 0) {
+        html += '<p><strong>Parser output:</strong></p><ul>';
+        diagnostics.forEach(line => {
+            html += `<li>${escapeHtml(line)}</li>`;
+        });
+        html += '</ul>';
+    }
+    
+    resultsDiv.innerHTML = html;
+}
+
 function validateConfiguration() {
     const textarea = document.getElementById('fullOutput');
     const configText = textarea.value.trim();
@@ -289,6 +352,12 @@ function validateConfiguration() {
     // Also handle case without password
     content = content.replace(/^CFG:/, '');
     
+    // The library's own parser decides when the tool was built with it
+    if (pinCfgParser) {
+        showParserValidation(validateWithParser(content.replace(/\n/g, '')));
+        return;
+    }
+    
     // Parse each line
     const configLines = content.split(/\n/).map(l => l.trim()).filter(l => l && !l.startsWith('#'));
     
@@ -0,0 +1,52 @@
+/**
+ * Entry points of the parser build the config tool embeds (build-config-tool.py, emscripten). Built in static
+ * arena mode like the nodes, wasm32 has 4-byte pointers and the non-AVR defaults - the memory requirement is the
+ * one PinCfgCsv_eValidate reports on a 32-bit node (ARM, ESP), AVR nodes need less. The diagnostics are the text
+ * of the CLI's VALIDATION_ERROR.
+ */
+#include <stdint.h>
+
+#include "PinCfgCsv.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#define PINCFG_WASM_EXPORT EMSCRIPTEN_KEEPALIVE
+#else
+#define PINCFG_WASM_EXPORT
+#endif
+
+// validation allocates nothing, the arena holds the context only
+#define PINCFG_WASM_MEMORY_SZ 4096
+#define PINCFG_WASM_OUT_SZ 4096
+
+PINCFG_RESULT_T PinCfgCsv_eInitMemoryAndTypes(uint8_t *pu8Memory, size_t szMemorySize);
+
+// EEPROM image the mocks work on (normally provided by test_helpers.c)
+uint8_t mock_EEPROM[1024];
+
+static uint8_t _au8Memory[PINCFG_WASM_MEMORY_SZ];
+static char _acOut[PINCFG_WASM_OUT_SZ];
+static size_t _szMemoryRequired;
+
+// PINCFG_RESULT_T of the validation, the details are read by the functions below
+PINCFG_WASM_EXPORT int PinCfgWasm_iValidate(const char *pcConfig)
+{
+    _acOut[0] = '\0';
+    _szMemoryRequired = 0;
+
+    PINCFG_RESULT_T eResult = PinCfgCsv_eInitMemoryAndTypes(_au8Memory, sizeof(_au8Memory));
+    if (eResult != PINCFG_OK_E)
+        return (int)eResult;
+
+    return (int)PinCfgCsv_eValidate(pcConfig, &_szMemoryRequired, _acOut, (uint16_t)sizeof(_acOut));
+}
+
+PINCFG_WASM_EXPORT uint32_t PinCfgWasm_u32MemoryRequired(void)
+{
+    return (uint32_t)_szMemoryRequired;
+}
+
+PINCFG_WASM_EXPORT const char *PinCfgWasm_pcOutput(void)
+{
+    return _acOut;
+}
@@ -5,11 +5,14 @@
 
 #include "CliAuth.h"
 #include "Globals.h"
+#include "LoopStats.h"
 #include "Memory.h"
 #include "MySensorsWrapper.h"
 #include "PersistentConfiguration.h"
 #include "PinCfgCsv.h"
 #include "PinCfgUtils.h"
+#include "Profiler.h"
+#include "Trace.h"
 #ifdef FWCHECK_ENABLED
 #include "FWCheck.h"
 #endif
@@ -34,6 +37,11 @@ static const char *_pcMsgEND = "]#";
 static const char *_pcCfgPrefix = "CFG:";
 static const char *_pcCmdPrefix = "CMD:";
 
+// Sequenced fragment: '~', 2 hex digits of the sequence number, data
+static const char _cSeqMark = '~';
+#define CLI_SEQ_HDR_SZ (3U)
+#define CLI_SEQ_SLOT_SZ (PINCFG_TXTSTATE_MAX_SZ_D - CLI_SEQ_HDR_SZ + 1U)
+
 static const char *_pcLockedOutMsg = "Locked out. Try again later.";
 static const char *_pcAuthFailedMsg = "Authentication failed.";
 static const char *_pcAutnRequiredMsg = "Authentication required.";
@@ -44,7 +52,15 @@ static const char *_pcInvalidMsgFormat = "Invalid message format.";
 
 static void Cli_vConfigurationReceived(CLI_T *psHandle);
 static void Cli_vExecuteCommand(CLI_T *psHandle, char *pcCmd);
-static void Cli_vSendBigMessage(CLI_T *psHandle, char *pcBigMsg);
+static void Cli_vPatchConfiguration(CLI_T *psHandle, const char *pcPatch);
+static void Cli_vSendBigMessage(CLI_T *psHandle, char *pcBigMsg, CLI_STATE_T eFinalState);
+static void Cli_vSendNextChunk(CLI_T *psHandle, uint32_t u32ms);
+static void Cli_vAbortBigMessage(CLI_T *psHandle);
+static void Cli_vRcvData(CLI_T *psHandle, const char *pcMessage);
+static void Cli_vRcvSequenced(CLI_T *psHandle, const char *pcFragment, uint32_t u32ms);
+static void Cli_vSendSeqReport(CLI_T *psHandle);
+static void Cli_vEndSequenced(CLI_T *psHandle);
+static bool Cli_bIsReceiving(CLI_T *psHandle);
 static void Cli_vResetState(CLI_T *psHandle);
 static bool Cli_bAppendToBuffer(CLI_T *psHandle, const char *pcData);
 static bool Cli_bHandleFragment(CLI_T *psHandle, const char *pcMessage, bool *pbAlreadyAppended);
@@ -74,7 +90,7 @@ void Cli_vInitType(PRESENTABLE_VTAB_T *psVtab)
     psVtab->vPresent = Presentable_vPresent;
 }
 
-CLI_RESULT_T Cli_eInit(CLI_T *psHandle, uint8_t u8Id)
+CLI_RESULT_T Cli_eInit(CLI_T *psHandle, uint16_t u16Id)
 {
     if (psHandle == NULL)
     {
@@ -85,15 +101,24 @@ CLI_RESULT_T Cli_eInit(CLI_T *psHandle, uint8_t u8Id)
     psHandle->sPresentable.psVtab = &psGlobals->sCliPrVTab;
 
     // LOOPRE init
+    Presentable_eInitReuseName(&psHandle->sPresentable, "CLI", u16Id);
     psHandle->sPresentable.ePayloadType = P_STRING;
-    psHandle->sPresentable.pcName = "CLI";
-    psHandle->sPresentable.u8Id = u8Id;
 
     // Initialize handle items
     psHandle->pcCfgBuf = NULL;
     psHandle->eState = CLI_READY_E;
     psHandle->sPresentable.pcState = _apcStateStrings[CLI_READY_E];
     psHandle->u16CfgNext = 0;
+    psHandle->pcTxBuf = NULL;
+    psHandle->u16TxLen = 0;
+    psHandle->u16TxNext = 0;
+    psHandle->u32TxLastMs = 0;
+    psHandle->eTxFinalState = CLI_READY_E;
+    psHandle->pcSeqWin = NULL;
+    psHandle->u32SeqLastMs = 0;
+    psHandle->u8SeqNext = 0;
+    psHandle->u8SeqMask = 0;
+    psHandle->bSeqReported = true;
 
     // Initialize rate limiting
     psHandle->u8FailedAttempts = 0;
@@ -151,6 +176,20 @@ static void Cli_vResetState(CLI_T *psHandle)
     psHandle->u16CfgNext = 0;
 }
 
+void Cli_vReleaseBuffers(CLI_T *psHandle)
+{
+    if (psHandle->pcTxBuf != NULL)
+        Cli_vAbortBigMessage(psHandle);
+    if (psHandle->pcSeqWin != NULL)
+        Cli_vEndSequenced(psHandle);
+    Cli_vResetState(psHandle);
+}
+
+void Cli_vRestartNode(void)
+{
+    resetFunc();
+}
+
 // Helper: Shift buffer left by removing everything before position
 static void Cli_vShiftBuffer(CLI_T *psHandle, size_t szStartPos)
 {
@@ -179,7 +218,9 @@ static bool Cli_bHandleFragment(CLI_T *psHandle, const char *pcMessage, bool *pb
 
     *pbAlreadyAppended = true;
     psHandle->u32ReceivingStartedMs = u32Millis(); // Reset timeout on each fragment
-    Presentable_vSendState((PRESENTABLE_T *)psHandle);
+    // sequenced uploads are acknowledged per window, not per fragment
+    if (psHandle->pcSeqWin == NULL)
+        Presentable_vSendState((PRESENTABLE_T *)psHandle);
     return true; // Continue processing
 }
 
@@ -187,7 +228,7 @@ static bool Cli_bHandleFragment(CLI_T *psHandle, const char *pcMessage, bool *pb
 static bool Cli_bAppendToBuffer(CLI_T *psHandle, const char *pcData)
 {
     size_t szLen = strlen(pcData);
-    if (psHandle->u16CfgNext + szLen >= PINCFG_CONFIG_MAX_SZ_D)
+    if (psHandle->u16CfgNext + szLen >= PINCFG_CONFIG_TEXT_MAX_SZ_D)
     {
         Cli_vSetState(psHandle, CLI_CUSTOM_E, _pcDataTooLargeMsg, true);
         Cli_vResetState(psHandle);
@@ -204,9 +245,6 @@ static bool Cli_bAppendToBuffer(CLI_T *psHandle, const char *pcData)
 void Cli_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg)
 {
     CLI_T *psHandle = (CLI_T *)psBaseHandle;
-    const char *pcMessage = pcMsg->data;
-    char *pcBeginPos = NULL;
-    bool bAlreadyAppended = false;
 
 #ifdef MY_CONTROLLER_HA
     psHandle->sPresentable.u8Flags |= PRESENTABLE_FLAG_STATE_PRESENTED;
@@ -221,6 +259,18 @@ void Cli_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg)
     }
 #endif
 
+    if (pcMsg->data[0] == _cSeqMark)
+        Cli_vRcvSequenced(psHandle, pcMsg->data + 1, u32Millis());
+    else
+        Cli_vRcvData(psHandle, pcMsg->data);
+}
+
+// Feeds one fragment of the "#[<pwd>/<type>:...]#" stream to the receive state machine
+static void Cli_vRcvData(CLI_T *psHandle, const char *pcMessage)
+{
+    char *pcBeginPos = NULL;
+    bool bAlreadyAppended = false;
+
     // Handle terminal/error states: reset to READY if message contains begin marker
     // This covers: CLI_OUT_OF_MEM_ERR_E, CLI_VALIDATION_OK_E, CLI_VALIDATION_ERROR_E, CLI_CUSTOM_E
     if (psHandle->eState != CLI_READY_E && psHandle->eState != CLI_RECEIVING_AUTH_E &&
@@ -250,18 +300,21 @@ void Cli_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg)
 
         pcMessage = pcBeginPos;
 
+        // new transaction - the client is not listening to the previous response anymore
+        if (psHandle->pcTxBuf != NULL)
+            Cli_vAbortBigMessage(psHandle);
+
         // Allocate buffer if needed
         if (psHandle->pcCfgBuf == NULL)
         {
             size_t szFreeMemory = Memory_szGetFree();
-            if (szFreeMemory >= PINCFG_CONFIG_MAX_SZ_D)
+            if (szFreeMemory >= PINCFG_CONFIG_TEXT_MAX_SZ_D)
+                psHandle->pcCfgBuf = (char *)Memory_vpTempAlloc(PINCFG_CONFIG_TEXT_MAX_SZ_D);
+
+            if (psHandle->pcCfgBuf == NULL)
             {
-                psHandle->pcCfgBuf = (char *)Memory_vpTempAlloc(PINCFG_CONFIG_MAX_SZ_D);
-                if (psHandle->pcCfgBuf == NULL)
-                {
-                    Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
-                    return;
-                }
+                Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+                return;
             }
         }
 
@@ -410,9 +463,22 @@ static void Cli_vConfigurationReceived(CLI_T *psHandle)
     {
         Cli_vSetState(psHandle, CLI_VALIDATION_OK_E, NULL, true);
         vWait(PINCFG_LONG_MESSAGE_DELAY_MS_D);
+        // validation output is not needed anymore, leave the memory to the config compression
+        if (pcOut != NULL)
+        {
+            Memory_vTempFreePt(pcOut);
+            pcOut = NULL;
+        }
         // Save config (PersistentCfg will preserve existing pwd)
         if (PersistentCfg_eSaveConfig(psHandle->pcCfgBuf) == PERCFG_OK_E)
+        {
+#if PINCFG_HOT_RELOAD_D
+            // this CLI is part of the config being replaced
+            PinCfgCsv_vRequestReload();
+#else
             resetFunc();
+#endif
+        }
         else
             Cli_vSetState(psHandle, CLI_CUSTOM_E, "Save of cfg unsucessfull.", true);
     }
@@ -420,7 +486,13 @@ static void Cli_vConfigurationReceived(CLI_T *psHandle)
     {
         if (pcOut != NULL && strlen(pcOut) > 0)
         {
-            Cli_vSendBigMessage(psHandle, pcOut);
+            // pcOut is released by the transfer, VALIDATION_ERROR and READY follow the last chunk. It spans the whole
+            // gap, only the text stays pinned while the chunks go out.
+            Memory_vTempFreePt(psHandle->pcCfgBuf);
+            psHandle->pcCfgBuf = NULL;
+            pcOut = (char *)Memory_vpTempShrink(pcOut, strlen(pcOut) + 1);
+            Cli_vSendBigMessage(psHandle, pcOut, CLI_VALIDATION_ERROR_E);
+            return;
         }
 
         Cli_vSetState(psHandle, CLI_VALIDATION_ERROR_E, NULL, true);
@@ -432,6 +504,69 @@ static void Cli_vConfigurationReceived(CLI_T *psHandle)
     Cli_vSetState(psHandle, CLI_READY_E, NULL, true);
 }
 
+// CFG_PATCH: only the edited lines travel, the stored config is patched, validated and saved here
+static void Cli_vPatchConfiguration(CLI_T *psHandle, const char *pcPatch)
+{
+    uint16_t u16CfgSize = 0;
+    if (PersistentCfg_eGetConfigSize(&u16CfgSize) != PERCFG_OK_E)
+    {
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, "Unable to read cfg size.", true);
+        return;
+    }
+
+    // the patched config may grow up to what an upload can carry
+    size_t szCfgMax = (u16CfgSize > PINCFG_CONFIG_TEXT_MAX_SZ_D) ? u16CfgSize : PINCFG_CONFIG_TEXT_MAX_SZ_D;
+    char *pcCfg = (char *)Memory_vpTempAlloc(szCfgMax + 1);
+    if (pcCfg == NULL)
+    {
+        Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+        return;
+    }
+
+    pcCfg[0] = '\0';
+    if (u16CfgSize > 0 && PersistentCfg_eLoadConfig(pcCfg) != PERCFG_OK_E)
+    {
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, "Unable to load cfg.", true);
+        Memory_vTempFreePt(pcCfg);
+        return;
+    }
+
+    PINCFG_RESULT_T eResult = PinCfgCsv_ePatch(pcCfg, pcPatch, pcCfg, szCfgMax + 1);
+    if (eResult != PINCFG_OK_E)
+    {
+        const char *pcMsg = _pcInvalidMsgFormat;
+        if (eResult == PINCFG_MAXLEN_ERROR_E)
+            pcMsg = _pcDataTooLargeMsg;
+        else if (eResult == PINCFG_ERROR_E)
+            pcMsg = "Patched item not found.";
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, pcMsg, true);
+        Memory_vTempFreePt(pcCfg);
+        return;
+    }
+
+    size_t szMemoryRequired = 0;
+    if (PinCfgCsv_eValidate(pcCfg, &szMemoryRequired, NULL, 0) != PINCFG_OK_E)
+    {
+        Cli_vSetState(psHandle, CLI_VALIDATION_ERROR_E, NULL, true);
+        Memory_vTempFreePt(pcCfg);
+        return;
+    }
+
+    if (PersistentCfg_eSaveConfig(pcCfg) == PERCFG_OK_E)
+    {
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, "Cfg patched.", true);
+#if PINCFG_HOT_RELOAD_D
+        PinCfgCsv_vRequestReload();
+#else
+        resetFunc();
+#endif
+    }
+    else
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, "Save of cfg unsucessfull.", true);
+
+    Memory_vTempFreePt(pcCfg);
+}
+
 // Execute command after authentication (pcCmd is command string without pwd)
 static void Cli_vExecuteCommand(CLI_T *psHandle, char *pcCmd)
 {
@@ -489,10 +624,70 @@ static void Cli_vExecuteCommand(CLI_T *psHandle, char *pcCmd)
             return;
         }
 
-        Cli_vSendBigMessage(psHandle, pcCfgBuf);
-        Memory_vTempFreePt(pcCfgBuf);
-        Cli_vSetState(psHandle, CLI_READY_E, NULL, true);
+        Cli_vSendBigMessage(psHandle, pcCfgBuf, CLI_READY_E);
+    }
+    else if (strncmp(pcCmd, "CFG_PATCH:", 10) == 0)
+    {
+        // CFG_PATCH:<line>/-<name>/...
+        Cli_vPatchConfiguration(psHandle, pcCmd + 10);
+    }
+#if PINCFG_LOOPSTATS_D
+    else if (strcmp(pcCmd, "GET_LOOPSTATS") == 0)
+    {
+        char *pcBuf = (char *)Memory_vpTempAlloc(LOOPSTATS_TEXT_MAX_SZ);
+        if (pcBuf == NULL)
+        {
+            Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+            return;
+        }
+
+        LoopStats_szReadAndReset(pcBuf, LOOPSTATS_TEXT_MAX_SZ);
+        Cli_vSendBigMessage(psHandle, pcBuf, CLI_READY_E);
     }
+#endif
+#if PINCFG_PROFILER_D
+    else if (strcmp(pcCmd, "GET_PROFILE") == 0)
+    {
+        size_t szBufSize = Profiler_szGetTextSize();
+        char *pcBuf = (char *)Memory_vpTempAlloc(szBufSize);
+        if (pcBuf == NULL)
+        {
+            Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+            return;
+        }
+
+        Profiler_szReadAndReset(pcBuf, szBufSize);
+        Cli_vSendBigMessage(psHandle, pcBuf, CLI_READY_E);
+    }
+#endif
+#if PINCFG_MEMSTATS_D
+    else if (strcmp(pcCmd, "GET_MEM") == 0)
+    {
+        char *pcBuf = (char *)Memory_vpTempAlloc(MEMORY_STATS_TEXT_MAX_SZ);
+        if (pcBuf == NULL)
+        {
+            Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+            return;
+        }
+
+        Memory_szFormatStats(pcBuf, MEMORY_STATS_TEXT_MAX_SZ);
+        Cli_vSendBigMessage(psHandle, pcBuf, CLI_READY_E);
+    }
+#endif
+#if PINCFG_TRACE_D
+    else if (strcmp(pcCmd, "GET_TRACE") == 0)
+    {
+        char *pcBuf = (char *)Memory_vpTempAlloc(TRACE_TEXT_MAX_SZ);
+        if (pcBuf == NULL)
+        {
+            Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+            return;
+        }
+
+        Trace_szRead(pcBuf, TRACE_TEXT_MAX_SZ);
+        Cli_vSendBigMessage(psHandle, pcBuf, CLI_READY_E);
+    }
+#endif
     else if (strcmp(pcCmd, "RESET") == 0)
     {
         resetFunc();
@@ -539,9 +734,7 @@ static void Cli_vExecuteCommand(CLI_T *psHandle, char *pcCmd)
                 }
             }
 
-            Cli_vSendBigMessage(psHandle, pcBuf);
-            Memory_vTempFreePt(pcBuf);
-            Cli_vSetState(psHandle, CLI_READY_E, NULL, true);
+            Cli_vSendBigMessage(psHandle, pcBuf, CLI_READY_E);
         }
     }
     else if (strcmp(pcCmd, "CLR_TSP_ERRORS") == 0)
@@ -591,12 +784,20 @@ void Cli_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
 {
     CLI_T *psHandle = container_of(psLoopableHandle, CLI_T, sLoopable);
 
+    // Sequenced upload: report progress once the sender goes quiet, give up with the receive timeout
+    if (psHandle->pcSeqWin != NULL)
+    {
+        uint32_t u32Elapsed = PinCfg_u32GetElapsedTime(psHandle->u32SeqLastMs, u32ms);
+        if (u32Elapsed >= PINCFG_CLI_RECEIVE_TIMEOUT_MS_D)
+            Cli_vEndSequenced(psHandle);
+        else if (!psHandle->bSeqReported && u32Elapsed >= PINCFG_CLI_SEQ_ACK_DELAY_MS_D)
+            Cli_vSendSeqReport(psHandle);
+    }
+
     // Check for fragmented message receive timeout
     if (psHandle->u32ReceivingStartedMs != 0)
     {
-        bool bIsReceiving =
-            (psHandle->eState == CLI_RECEIVING_AUTH_E || psHandle->eState == CLI_RECEIVING_TYPE_E ||
-             psHandle->eState == CLI_RECEIVING_CFG_DATA_E || psHandle->eState == CLI_RECEIVING_CMD_DATA_E);
+        bool bIsReceiving = Cli_bIsReceiving(psHandle);
 
         if (bIsReceiving &&
             PinCfg_u32GetElapsedTime(psHandle->u32ReceivingStartedMs, u32ms) >= PINCFG_CLI_RECEIVE_TIMEOUT_MS_D)
@@ -612,6 +813,13 @@ void Cli_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
         }
     }
 
+    // Pending chunked response
+    if (psHandle->pcTxBuf != NULL &&
+        PinCfg_u32GetElapsedTime(psHandle->u32TxLastMs, u32ms) >= PINCFG_LONG_MESSAGE_DELAY_MS_D)
+    {
+        Cli_vSendNextChunk(psHandle, u32ms);
+    }
+
 #ifdef FWCHECK_ENABLED
     // Periodic firmware CRC check (once per day)
     if (PinCfg_u32GetElapsedTime(psHandle->u32LastFwCrcCheckMs, u32ms) >= PINCFG_FW_CRC_CHECK_INTERVAL_MS_D)
@@ -627,18 +835,183 @@ void Cli_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
 #endif
 }
 
-static void Cli_vSendBigMessage(CLI_T *psHandle, char *pcBigMsg)
+// Takes over pcBigMsg (temp memory) and sends it in PINCFG_TXTSTATE_MAX_SZ_D chunks, one per
+// PINCFG_LONG_MESSAGE_DELAY_MS_D from Cli_vLoop. eFinalState (if not READY) and READY are reported afterwards.
+static void Cli_vSendBigMessage(CLI_T *psHandle, char *pcBigMsg, CLI_STATE_T eFinalState)
 {
-    size_t szMsgSize = strlen(pcBigMsg);
-    uint8_t u8MyMsgsCount = szMsgSize / PINCFG_TXTSTATE_MAX_SZ_D;
+    if (psHandle->pcTxBuf != NULL)
+        Cli_vAbortBigMessage(psHandle);
+
+    psHandle->pcTxBuf = pcBigMsg;
+    psHandle->u16TxLen = (uint16_t)strlen(pcBigMsg);
+    psHandle->u16TxNext = 0;
+    psHandle->eTxFinalState = eFinalState;
 
-    if ((szMsgSize % PINCFG_TXTSTATE_MAX_SZ_D) > 0)
-        u8MyMsgsCount++;
+    Cli_vSendNextChunk(psHandle, u32Millis());
+}
+
+static void Cli_vSendNextChunk(CLI_T *psHandle, uint32_t u32ms)
+{
+    psHandle->u32TxLastMs = u32ms;
 
-    for (uint8_t u8i = 0; u8i < u8MyMsgsCount; u8i++)
+    if (psHandle->u16TxNext < psHandle->u16TxLen)
     {
-        psHandle->sPresentable.pcState = pcBigMsg + (u8i * PINCFG_TXTSTATE_MAX_SZ_D);
+        psHandle->sPresentable.pcState = psHandle->pcTxBuf + psHandle->u16TxNext;
         Presentable_vSendState((PRESENTABLE_T *)psHandle);
-        vWait(PINCFG_LONG_MESSAGE_DELAY_MS_D);
+        psHandle->u16TxNext += PINCFG_TXTSTATE_MAX_SZ_D;
+        return;
+    }
+
+    // all chunks out
+    CLI_STATE_T eFinalState = psHandle->eTxFinalState;
+    Cli_vAbortBigMessage(psHandle);
+    if (eFinalState != CLI_READY_E)
+        Cli_vSetState(psHandle, eFinalState, NULL, true);
+    Cli_vSetState(psHandle, CLI_READY_E, NULL, true);
+}
+
+static void Cli_vAbortBigMessage(CLI_T *psHandle)
+{
+    Memory_vTempFreePt(psHandle->pcTxBuf);
+    psHandle->pcTxBuf = NULL;
+    psHandle->u16TxLen = 0;
+    psHandle->u16TxNext = 0;
+    // state must not point to the released buffer
+    if (psHandle->eState != CLI_CUSTOM_E)
+        psHandle->sPresentable.pcState = _apcStateStrings[psHandle->eState];
+    else
+        psHandle->sPresentable.pcState = NULL;
+}
+
+static bool Cli_bIsReceiving(CLI_T *psHandle)
+{
+    return psHandle->eState == CLI_RECEIVING_AUTH_E || psHandle->eState == CLI_RECEIVING_TYPE_E ||
+           psHandle->eState == CLI_RECEIVING_CFG_DATA_E || psHandle->eState == CLI_RECEIVING_CMD_DATA_E;
+}
+
+// Sequenced fragment "~SSdata": SS is the sequence number (hex, wraps at FF). Fragments within
+// PINCFG_CLI_SEQ_WINDOW_D of the next expected one are accepted in any order and fed to the stream in order.
+// The node answers with "ACK:<next>" or "NAK:<missing>,..." at the end of each window, on duplicates and after
+// PINCFG_CLI_SEQ_ACK_DELAY_MS_D of silence, so the sender only retransmits what got lost.
+static void Cli_vRcvSequenced(CLI_T *psHandle, const char *pcFragment, uint32_t u32ms)
+{
+    char acSeq[3];
+    uint8_t u8Seq;
+
+    strncpy(acSeq, pcFragment, 2);
+    acSeq[2] = '\0';
+    if (!CliAuth_bHexToBinary(acSeq, &u8Seq, 1))
+    {
+        Cli_vSetState(psHandle, CLI_CUSTOM_E, _pcInvalidMsgFormat, true);
+        return;
+    }
+    const char *pcData = pcFragment + 2;
+
+    // first fragment of a new upload restarts the numbering
+    if (psHandle->pcSeqWin != NULL && u8Seq == 0U && strncmp(pcData, _pcMsgBegin, 2) == 0)
+        Cli_vEndSequenced(psHandle);
+
+    if (psHandle->pcSeqWin == NULL)
+    {
+        psHandle->pcSeqWin = (char *)Memory_vpTempAlloc(PINCFG_CLI_SEQ_WINDOW_D * CLI_SEQ_SLOT_SZ);
+        if (psHandle->pcSeqWin == NULL)
+        {
+            Cli_vSetState(psHandle, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+            return;
+        }
+        psHandle->u8SeqNext = 0U;
+        psHandle->u8SeqMask = 0U;
+    }
+    psHandle->u32SeqLastMs = u32ms;
+    psHandle->bSeqReported = false;
+
+    uint8_t u8Offset = (uint8_t)(u8Seq - psHandle->u8SeqNext);
+    if (u8Offset >= PINCFG_CLI_SEQ_WINDOW_D)
+    {
+        // duplicate (our ACK got lost) or outside of the window - tell the sender where we are
+        Cli_vSendSeqReport(psHandle);
+        return;
+    }
+
+    if (u8Offset > 0U)
+    {
+        uint8_t u8Slot = u8Seq % PINCFG_CLI_SEQ_WINDOW_D;
+        char *pcSlot = psHandle->pcSeqWin + (u8Slot * CLI_SEQ_SLOT_SZ);
+        strncpy(pcSlot, pcData, CLI_SEQ_SLOT_SZ - 1U);
+        pcSlot[CLI_SEQ_SLOT_SZ - 1U] = '\0';
+        psHandle->u8SeqMask |= (uint8_t)(1U << u8Slot);
+
+        // last fragment of the window arrived but something before it did not
+        if (u8Offset == PINCFG_CLI_SEQ_WINDOW_D - 1U)
+            Cli_vSendSeqReport(psHandle);
+        return;
+    }
+
+    uint8_t u8WindowStart = psHandle->u8SeqNext & (uint8_t)~(PINCFG_CLI_SEQ_WINDOW_D - 1U);
+    const char *pcNext = pcData;
+    for (;;)
+    {
+        Cli_vRcvData(psHandle, pcNext);
+        psHandle->u8SeqNext++;
+
+        // transaction finished (or failed) - its result is the answer
+        if (!Cli_bIsReceiving(psHandle))
+        {
+            Cli_vEndSequenced(psHandle);
+            return;
+        }
+
+        uint8_t u8Slot = psHandle->u8SeqNext % PINCFG_CLI_SEQ_WINDOW_D;
+        if ((psHandle->u8SeqMask & (1U << u8Slot)) == 0U)
+            break;
+
+        // fragment that arrived ahead of time is next
+        psHandle->u8SeqMask &= (uint8_t)~(1U << u8Slot);
+        pcNext = psHandle->pcSeqWin + (u8Slot * CLI_SEQ_SLOT_SZ);
     }
+
+    if ((psHandle->u8SeqNext & (uint8_t)~(PINCFG_CLI_SEQ_WINDOW_D - 1U)) != u8WindowStart)
+        Cli_vSendSeqReport(psHandle);
+}
+
+static void Cli_vSendSeqReport(CLI_T *psHandle)
+{
+    char acReport[PINCFG_TXTSTATE_MAX_SZ_D + 1];
+    const char *pcSavedState = psHandle->sPresentable.pcState;
+
+    if (psHandle->u8SeqMask == 0U)
+    {
+        snprintf(acReport, sizeof(acReport), "ACK:%02X", psHandle->u8SeqNext);
+    }
+    else
+    {
+        // everything before the last fragment held in the window that is not there yet
+        uint8_t u8Last = 0U;
+        for (uint8_t i = 1U; i < PINCFG_CLI_SEQ_WINDOW_D; i++)
+        {
+            if (psHandle->u8SeqMask & (1U << ((uint8_t)(psHandle->u8SeqNext + i) % PINCFG_CLI_SEQ_WINDOW_D)))
+                u8Last = i;
+        }
+
+        int iPos = snprintf(acReport, sizeof(acReport), "NAK:%02X", psHandle->u8SeqNext);
+        for (uint8_t i = 1U; i < u8Last; i++)
+        {
+            uint8_t u8Seq = (uint8_t)(psHandle->u8SeqNext + i);
+            if ((psHandle->u8SeqMask & (1U << (u8Seq % PINCFG_CLI_SEQ_WINDOW_D))) == 0U)
+                iPos += snprintf(acReport + iPos, sizeof(acReport) - iPos, ",%02X", u8Seq);
+        }
+    }
+
+    psHandle->sPresentable.pcState = acReport;
+    Presentable_vSendState((PRESENTABLE_T *)psHandle);
+    psHandle->sPresentable.pcState = pcSavedState;
+    psHandle->bSeqReported = true;
+}
+
+static void Cli_vEndSequenced(CLI_T *psHandle)
+{
+    Memory_vTempFreePt(psHandle->pcSeqWin);
+    psHandle->pcSeqWin = NULL;
+    psHandle->u8SeqMask = 0U;
+    psHandle->bSeqReported = true;
 }
@@ -41,6 +41,18 @@ typedef struct CLI_S
     char *pcCfgBuf;
     uint16_t u16CfgNext;
     CLI_STATE_T eState;
+    // Pending chunked response (temp memory), advanced by Cli_vLoop
+    char *pcTxBuf;
+    uint16_t u16TxLen;
+    uint16_t u16TxNext;
+    uint32_t u32TxLastMs;
+    CLI_STATE_T eTxFinalState; // state reported once the last chunk is out
+    // Sequenced upload ("~<seq hex><data>" fragments), reorder buffer in temp memory
+    char *pcSeqWin;
+    uint32_t u32SeqLastMs;
+    uint8_t u8SeqNext;  // next expected sequence number
+    uint8_t u8SeqMask;  // window slots holding fragments received ahead of u8SeqNext
+    bool bSeqReported; // ACK/NAK for the current progress already sent
     // Rate limiting for brute-force protection
     uint8_t u8FailedAttempts;   // Consecutive failed attempts
     uint32_t u32LockoutUntilMs; // Lockout end timestamp (0 = not locked)
@@ -48,10 +60,16 @@ typedef struct CLI_S
 
 void Cli_vInitType(PRESENTABLE_VTAB_T *psVtab);
 
-CLI_RESULT_T Cli_eInit(CLI_T *psHandle, uint8_t u8Id);
+CLI_RESULT_T Cli_eInit(CLI_T *psHandle, uint16_t u16Id);
 
 void Cli_vSetState(CLI_T *psHandle, CLI_STATE_T estate, const char *psState, bool bSendState);
 
+// Drops the receive, sequence and response buffers, the transaction in progress is lost
+void Cli_vReleaseBuffers(CLI_T *psHandle);
+
+// Restarts the node, the last resort when the running config is lost
+void Cli_vRestartNode(void);
+
 // presentable IF
 void Cli_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg);
 
@@ -0,0 +1,185 @@
+#include "CompositeTrigger.h"
+
+#include "PinCfgUtils.h"
+
+static void CompositeTrigger_vEventHandle(
+    IEVENTSUBSCRIBER_T *psBaseHandle,
+    uint8_t u8EventType,
+    uint32_t u32Data,
+    uint32_t u32ms);
+static void CompositeTrigger_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms);
+static bool CompositeTrigger_bResult(COMPOSITETRIGGER_T *psHandle);
+static void CompositeTrigger_vEvaluate(COMPOSITETRIGGER_T *psHandle, uint32_t u32ms);
+static void CompositeTrigger_vFire(COMPOSITETRIGGER_T *psHandle, uint32_t u32ms);
+
+COMPOSITETRIGGER_RESULT_T CompositeTrigger_eInit(
+    COMPOSITETRIGGER_T *psHandle,
+    COMPOSITETRIGGER_CONDITION_T *pasConditions,
+    uint8_t u8ConditionsCount,
+    TRIGGER_SWITCHACTION_T *pasSwAct,
+    uint8_t u8SwActCount,
+    COMPOSITETRIGGER_OPERATOR_T eOperator,
+    uint32_t u32HoldMs)
+{
+    if (psHandle == NULL || pasConditions == NULL || pasSwAct == NULL)
+        return COMPOSITETRIGGER_NULLPTR_ERROR_E;
+
+    if (u8SwActCount > PINCFG_TRIGGER_MAX_SWITCHES_D)
+        return COMPOSITETRIGGER_MAX_SWITCH_ERROR_E;
+
+    if (u8ConditionsCount == 0U || u8ConditionsCount > PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D)
+        return COMPOSITETRIGGER_MAX_CONDITION_ERROR_E;
+
+    psHandle->sLoopable.vLoop = CompositeTrigger_vLoop;
+
+    // parameters init
+    psHandle->pasConditions = pasConditions;
+    psHandle->u8ConditionsCount = u8ConditionsCount;
+    psHandle->pasSwAct = pasSwAct;
+    psHandle->u8SwActCount = u8SwActCount;
+    psHandle->eOperator = eOperator;
+    psHandle->u32HoldMs = u32HoldMs;
+
+    // state init
+    psHandle->u32TrueSinceMs = 0U;
+    psHandle->u8StateMask = 0U;
+    psHandle->u8NegateMask = 0U;
+
+    for (uint8_t i = 0; i < u8ConditionsCount; i++)
+    {
+        pasConditions[i].sEventSubscriber.psNext = NULL;
+        pasConditions[i].sEventSubscriber.vEventHandle = CompositeTrigger_vEventHandle;
+        pasConditions[i].psParent = psHandle;
+        pasConditions[i].u8Mask = (uint8_t)(1U << i);
+        if (pasConditions[i].bNegate)
+            psHandle->u8NegateMask |= pasConditions[i].u8Mask;
+    }
+
+    // negated conditions are true until their publisher says otherwise, so the rule may already hold;
+    // take that as the baseline without firing
+    psHandle->bResult = CompositeTrigger_bResult(psHandle);
+    psHandle->bFired = true;
+
+    return COMPOSITETRIGGER_OK_E;
+}
+
+static void CompositeTrigger_vEventHandle(
+    IEVENTSUBSCRIBER_T *psBaseHandle,
+    uint8_t u8EventType,
+    uint32_t u32Data,
+    uint32_t u32ms)
+{
+    COMPOSITETRIGGER_CONDITION_T *psCondition = (COMPOSITETRIGGER_CONDITION_T *)psBaseHandle;
+    COMPOSITETRIGGER_T *psHandle = psCondition->psParent;
+    TRIGGER_EVENTTYPE_T eEventType = (TRIGGER_EVENTTYPE_T)u8EventType;
+    int32_t i32Data = (int32_t)u32Data;
+    uint8_t u8OldMask = psHandle->u8StateMask;
+    bool bPulse = false;
+
+    switch (psCondition->eEventType)
+    {
+    // level conditions - hold their state until the opposite level arrives
+    case TRIGGER_DOWN_E:
+    case TRIGGER_UP_E:
+        if (eEventType != TRIGGER_DOWN_E && eEventType != TRIGGER_UP_E)
+            return;
+
+        if (eEventType == psCondition->eEventType)
+            psHandle->u8StateMask |= psCondition->u8Mask;
+        else
+            psHandle->u8StateMask &= ~psCondition->u8Mask;
+        break;
+
+    // value conditions - hold the result of the last comparison
+    case TRIGGER_HIGHER_E:
+    case TRIGGER_LOWER_E:
+    case TRIGGER_EXACT_E:
+    {
+        if (eEventType != TRIGGER_VALUE_E)
+            return;
+
+        bool bMatch = (psCondition->eEventType == TRIGGER_HIGHER_E && i32Data > psCondition->i32EventData) ||
+                      (psCondition->eEventType == TRIGGER_LOWER_E && i32Data < psCondition->i32EventData) ||
+                      (psCondition->eEventType == TRIGGER_EXACT_E && i32Data == psCondition->i32EventData);
+        if (bMatch)
+            psHandle->u8StateMask |= psCondition->u8Mask;
+        else
+            psHandle->u8StateMask &= ~psCondition->u8Mask;
+    }
+    break;
+
+    // momentary conditions - true only while the event is being handled
+    case TRIGGER_MULTI_E:
+        if (eEventType != TRIGGER_MULTI_E || i32Data != psCondition->i32EventData)
+            return;
+        bPulse = true;
+        break;
+
+    case TRIGGER_ALL_E: bPulse = true; break;
+
+    default:
+        if (eEventType != psCondition->eEventType)
+            return;
+        bPulse = true;
+        break;
+    }
+
+    if (bPulse)
+    {
+        psHandle->u8StateMask |= psCondition->u8Mask;
+        CompositeTrigger_vEvaluate(psHandle, u32ms);
+        psHandle->u8StateMask &= ~psCondition->u8Mask;
+    }
+    else if (psHandle->u8StateMask == u8OldMask)
+    {
+        // nothing changed, nothing to re-evaluate
+        return;
+    }
+
+    CompositeTrigger_vEvaluate(psHandle, u32ms);
+}
+
+static void CompositeTrigger_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
+{
+    COMPOSITETRIGGER_T *psHandle = container_of(psLoopableHandle, COMPOSITETRIGGER_T, sLoopable);
+
+    if (!psHandle->bResult || psHandle->bFired)
+        return;
+
+    if (PinCfg_u32GetElapsedTime(psHandle->u32TrueSinceMs, u32ms) >= psHandle->u32HoldMs)
+        CompositeTrigger_vFire(psHandle, u32ms);
+}
+
+static bool CompositeTrigger_bResult(COMPOSITETRIGGER_T *psHandle)
+{
+    uint8_t u8Effective = psHandle->u8StateMask ^ psHandle->u8NegateMask;
+
+    if (psHandle->eOperator == COMPOSITETRIGGER_AND_E)
+        return u8Effective == (uint8_t)((1U << psHandle->u8ConditionsCount) - 1U);
+
+    return u8Effective != 0U;
+}
+
+static void CompositeTrigger_vEvaluate(COMPOSITETRIGGER_T *psHandle, uint32_t u32ms)
+{
+    bool bResult = CompositeTrigger_bResult(psHandle);
+    if (bResult == psHandle->bResult)
+        return;
+
+    psHandle->bResult = bResult;
+    if (!bResult)
+        return;
+
+    // rising edge of the whole rule
+    psHandle->u32TrueSinceMs = u32ms;
+    psHandle->bFired = false;
+    if (psHandle->u32HoldMs == 0U)
+        CompositeTrigger_vFire(psHandle, u32ms);
+}
+
+static void CompositeTrigger_vFire(COMPOSITETRIGGER_T *psHandle, uint32_t u32ms)
+{
+    psHandle->bFired = true;
+    // rule activation is forwarded as UP so timed switches start (or extend) their period
+    Trigger_vDriveSwitches(psHandle->pasSwAct, psHandle->u8SwActCount, (uint8_t)TRIGGER_UP_E, 0, u32ms);
+}
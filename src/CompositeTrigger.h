@@ -0,0 +1,65 @@
+#ifndef COMPOSITETRIGGER_H
+#define COMPOSITETRIGGER_H
+
+#include "Event.h"
+#include "ILoopable.h"
+#include "Trigger.h"
+#include "Types.h"
+
+typedef enum COMPOSITETRIGGER_RESULT_E
+{
+    COMPOSITETRIGGER_OK_E,
+    COMPOSITETRIGGER_NULLPTR_ERROR_E,
+    COMPOSITETRIGGER_MAX_SWITCH_ERROR_E,
+    COMPOSITETRIGGER_MAX_CONDITION_ERROR_E,
+    COMPOSITETRIGGER_ERROR_E
+} COMPOSITETRIGGER_RESULT_T;
+
+typedef enum COMPOSITETRIGGER_OPERATOR_E
+{
+    COMPOSITETRIGGER_AND_E = 0,
+    COMPOSITETRIGGER_OR_E
+} COMPOSITETRIGGER_OPERATOR_T;
+
+typedef struct COMPOSITETRIGGER_S COMPOSITETRIGGER_T;
+
+// One condition subscribes to one publisher. The subscriber must stay the first member so the
+// publisher's callback can be cast back to the condition.
+typedef struct COMPOSITETRIGGER_CONDITION_S
+{
+    IEVENTSUBSCRIBER_T sEventSubscriber;
+    COMPOSITETRIGGER_T *psParent;
+    int32_t i32EventData;
+    TRIGGER_EVENTTYPE_T eEventType;
+    uint8_t u8Mask; // bit of this condition in parent's u8StateMask
+    bool bNegate;
+} COMPOSITETRIGGER_CONDITION_T;
+
+typedef struct COMPOSITETRIGGER_S
+{
+    LOOPABLE_T sLoopable; // used only when u32HoldMs > 0
+    COMPOSITETRIGGER_CONDITION_T *pasConditions;
+    TRIGGER_SWITCHACTION_T *pasSwAct;
+    uint32_t u32HoldMs;
+    uint32_t u32TrueSinceMs;
+    COMPOSITETRIGGER_OPERATOR_T eOperator;
+    uint8_t u8ConditionsCount;
+    uint8_t u8SwActCount;
+    uint8_t u8StateMask;  // raw (non negated) state of the conditions
+    uint8_t u8NegateMask; // conditions to be inverted before combining
+    bool bResult;
+    bool bFired;
+} COMPOSITETRIGGER_T;
+
+// ctor
+// pasConditions must have eEventType, i32EventData and bNegate filled in, the rest is initialized here
+COMPOSITETRIGGER_RESULT_T CompositeTrigger_eInit(
+    COMPOSITETRIGGER_T *psHandle,
+    COMPOSITETRIGGER_CONDITION_T *pasConditions,
+    uint8_t u8ConditionsCount,
+    TRIGGER_SWITCHACTION_T *pasSwAct,
+    uint8_t u8SwActCount,
+    COMPOSITETRIGGER_OPERATOR_T eOperator,
+    uint32_t u32HoldMs);
+
+#endif // COMPOSITETRIGGER_H
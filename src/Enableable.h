@@ -17,6 +17,6 @@ typedef enum ENABLEABLE_RESULT_E
     ENABLEABLE_ERROR_E
 } ENABLEABLE_RESULT_T;
 
-ENABLEABLE_RESULT_T Enableable_eInit(ENABLEABLE_T *psHandle, STRING_POINT_T *sName, uint8_t u8Id);
+ENABLEABLE_RESULT_T Enableable_eInit(ENABLEABLE_T *psHandle, STRING_POINT_T *sName, uint16_t u16Id);
 
 #endif // ENABLEABLE_H
\ No newline at end of file
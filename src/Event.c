@@ -1,5 +1,7 @@
 #include "Event.h"
 
+#include "Trace.h"
+
 EVENTSUBSCRIBER_RESULT_T EventPublisher_eAddSubscriber(IEVENTPUBLISHER_T *psHandle, IEVENTSUBSCRIBER_T *psSubscriber)
 {
     if (psHandle == NULL || psSubscriber == NULL)
@@ -24,6 +26,8 @@ EVENTSUBSCRIBER_RESULT_T EventPublisher_eAddSubscriber(IEVENTPUBLISHER_T *psHand
 
 void EventPublisher_vSendEvent(IEVENTPUBLISHER_T *psHandle, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms)
 {
+    Trace_vEvent(psHandle->sPresentable.u16Id, u8EventType, i32Data, u32ms);
+
     IEVENTSUBSCRIBER_T *psCurrent = psHandle->psFirstSubscriber;
     while (psCurrent != NULL)
     {
@@ -18,9 +18,15 @@
 #include "Event.h"
 #include "ILoopable.h"
 #include "ISensorMeasure.h"
+#include "InPin.h"
+#include "Memory.h"
 #include "Presentable.h"
+#include "Profiler.h"
+#include "Switch.h"
+#include "Trace.h"
 
-typedef struct
+// one pinCfg instance, PINCFG_CTX_T of the public API
+typedef struct PINCFG_CTX_S
 {
 #ifndef USE_MALLOC
     // memory
@@ -28,13 +34,30 @@ typedef struct
     char *pvMemNext;
     char *pvMemTempEnd;
     bool bMemIsInitialized;
+#else
+    void *pvMemPermanent; // last permanent block, the blocks are chained for Memory_eResetPermanent
 #endif // USE_MALLOC
+    // packed names
+    char *pcNameNext;
+    char *pcNameEnd;
 
     // pincfgcsv
-    uint8_t u8LoopablesCount;
-    uint8_t u8PresentablesCount;
+    uint16_t u16LoopablesCount;
+    uint16_t u16PresentablesCount;
+    uint16_t u16LoopablesMax; // sizes of the arrays allocated by the counting pass
+    uint16_t u16PresentablesMax;
+    uint16_t u16PresentationIdx;   // next presentable to present / send initial state of
+    uint8_t u8PresentationState; // PINCFG_PRESENTATION_STATE_T
+    bool bReloadPending;         // stored config is reloaded at the start of the next loop
     LOOPABLE_T **ppsLoopables;
     PRESENTABLE_T **ppsPresentables;
+    // switches and inputs are stored by type and looped without the loopable indirection
+    SWITCH_T *pasSwitches;
+    INPIN_T *pasInPins;
+    uint16_t u16SwitchesCount;
+    uint16_t u16SwitchesMax;
+    uint16_t u16InPinsCount;
+    uint16_t u16InPinsMax;
     PRESENTABLE_VTAB_T sSwitchPrVTab;
     PRESENTABLE_VTAB_T sInPinPrVTab;
     PRESENTABLE_VTAB_T sCliPrVTab;
@@ -45,8 +68,42 @@ typedef struct
     // Switch
     uint32_t u32SwitchImpulseDurationMs;
     uint32_t u32SwitchFbDelayMs;
+    // presentation pacing
+    uint32_t u32PresentationSlotMs;
+    // outgoing messages
+    SENDQUEUE_T sSendQueue;
+    // state journal
+    uint32_t u32StateJournalDirtyMs; // first change not written yet
+    bool bStateJournalDirty;
+#if PINCFG_MEMSTATS_D
+    // arena usage
+    size_t aszMemTagged[MEMORY_TAG_COUNT_E]; // permanent bytes of the current generation
+    uint8_t u8MemTag;                        // MEMORY_TAG_T of the next permanent allocation
+#ifndef USE_MALLOC
+    size_t szMemFreeMin;
+    size_t szMemTempMax;
+#endif
+#endif
+#if PINCFG_LOOPSTATS_D
+    // loop time statistics since the last GET_LOOPSTATS
+    uint32_t u32LoopStatsCount;
+    uint32_t u32LoopStatsMaxUs;
+    uint32_t au32LoopStatsHist[PINCFG_LOOPSTATS_BUCKETS_D]; // saturating, days at any loop rate
+#endif
+#if PINCFG_TRACE_D
+    // event trace ring
+    TRACE_ENTRY_T asTrace[PINCFG_TRACE_SIZE_D];
+    uint16_t u16TraceHead; // next entry written
+    uint16_t u16TraceCount;
+    uint16_t u16TracePublisherId; // source of the event being delivered
+#endif
+#if PINCFG_PROFILER_D
+    // loopables, inputs and switches, placed by the *Max sizes
+    PROFILER_ENTRY_T *pasProfile;
+#endif
 } GLOBALS_T;
 
-extern GLOBALS_T *psGlobals;
+// active instance of the calling thread
+extern PINCFG_THREAD_LOCAL GLOBALS_T *psGlobals;
 
 #endif // GLOBALS_H
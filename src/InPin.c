@@ -31,12 +31,25 @@ void InPin_vInitType(PRESENTABLE_VTAB_T *psVtab)
     InPin_SetMulticlickMaxDelayMs(PINCFG_MULTICLICK_MAX_DELAY_MS_D);
 }
 
-INPIN_RESULT_T InPin_eInit(INPIN_T *psHandle, STRING_POINT_T *sName, uint8_t u8Id, uint8_t u8InPin)
+INPIN_RESULT_T InPin_eInit(INPIN_T *psHandle, STRING_POINT_T *sName, uint16_t u16Id, uint8_t u8InPin)
 {
     if (psHandle == NULL)
         return INPIN_NULLPTR_ERROR_E;
 
-    if (Presentable_eInit(&psHandle->sPresentable, sName, u8Id) != PRESENTABLE_OK_E)
+    if (Presentable_eInit(&psHandle->sPresentable, sName, u16Id) != PRESENTABLE_OK_E)
+    {
+        return INPIN_SUBINIT_ERROR_E;
+    }
+
+    return InPin_eInitReuseName(psHandle, psHandle->sPresentable.pcName, u16Id, u8InPin);
+}
+
+INPIN_RESULT_T InPin_eInitReuseName(INPIN_T *psHandle, const char *pcName, uint16_t u16Id, uint8_t u8InPin)
+{
+    if (psHandle == NULL)
+        return INPIN_NULLPTR_ERROR_E;
+
+    if (Presentable_eInitReuseName(&psHandle->sPresentable, pcName, u16Id) != PRESENTABLE_OK_E)
     {
         return INPIN_SUBINIT_ERROR_E;
     }
@@ -69,10 +82,8 @@ typedef enum
     INPIN_CHANGE_DOWN_E
 } INPIN_CHANGE_T;
 
-static void InPin_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
+static inline void InPin_vStep(INPIN_T *psHandle, uint32_t u32ms)
 {
-    INPIN_T *psHandle = container_of(psLoopableHandle, INPIN_T, sLoopable);
-
     INPIN_CHANGE_T eChange = INPIN_CHANGE_NOCHANGE_E;
     if (psHandle->ePinState != INPIN_DEBOUNCEDOWN_E && psHandle->ePinState != INPIN_DEBOUNCEUP_E)
     {
@@ -158,6 +169,17 @@ static void InPin_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
     }
 }
 
+static void InPin_vLoop(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
+{
+    InPin_vStep(container_of(psLoopableHandle, INPIN_T, sLoopable), u32ms);
+}
+
+void InPin_vLoopAll(INPIN_T *pasInPins, uint16_t u16Count, uint32_t u32ms)
+{
+    for (uint16_t i = 0; i < u16Count; i++)
+        InPin_vStep(&pasInPins[i], u32ms);
+}
+
 // presentable IF
 void InPin_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg)
 {
@@ -41,7 +41,12 @@ void InPin_SetDebounceMs(uint32_t debounce);
 void InPin_SetMulticlickMaxDelayMs(uint32_t multikMaxDelay);
 void InPin_vInitType(PRESENTABLE_VTAB_T *psVtab);
 
-INPIN_RESULT_T InPin_eInit(INPIN_T *psHandle, STRING_POINT_T *sName, uint8_t u8Id, uint8_t u8InPin);
+INPIN_RESULT_T InPin_eInit(INPIN_T *psHandle, STRING_POINT_T *sName, uint16_t u16Id, uint8_t u8InPin);
+// pcName is not copied, it must outlive the input
+INPIN_RESULT_T InPin_eInitReuseName(INPIN_T *psHandle, const char *pcName, uint16_t u16Id, uint8_t u8InPin);
+
+// loops all inputs of a contiguous array, equal to calling sLoopable.vLoop of each
+void InPin_vLoopAll(INPIN_T *pasInPins, uint16_t u16Count, uint32_t u32ms);
 
 // presentable IF
 void InPin_vRcvMessage(PRESENTABLE_T *psBaseHandle, const MyMessage *pcMsg);
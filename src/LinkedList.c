@@ -76,30 +76,3 @@ void *LinkedList_pvGetStoredItem(LINKEDLIST_ITEM_T *psLLItem)
 
     return psLLItem->pvItem;
 }
-
-LINKEDLIST_RESULT_T LinkedList_eLinkedListToArray(LINKEDLIST_ITEM_T **ppsFirst, uint8_t *u8Count)
-{
-    if (ppsFirst == NULL || u8Count == NULL)
-        return LINKEDLIST_NULLPTR_ERROR_E;
-
-    size_t szCount = 0;
-    LINKEDLIST_RESULT_T eResult = LinkedList_eGetLength(ppsFirst, &szCount);
-    if (eResult != LINKEDLIST_OK_E)
-        return eResult;
-
-    void **pvArray = (void **)Memory_vpAlloc(sizeof(void *) * szCount);
-    if (pvArray == NULL)
-        return LINKEDLIST_OUTOFMEMORY_ERROR_E;
-
-    *u8Count = 0U;
-    void *pvItem = LinkedList_pvPopFront(ppsFirst);
-    while (pvItem != NULL)
-    {
-        pvArray[*u8Count] = pvItem;
-        (*u8Count)++;
-        pvItem = LinkedList_pvPopFront(ppsFirst);
-    }
-    *ppsFirst = (LINKEDLIST_ITEM_T *)pvArray;
-
-    return LINKEDLIST_OK_E;
-}
\ No newline at end of file
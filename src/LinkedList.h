@@ -23,6 +23,4 @@ LINKEDLIST_ITEM_T *LinkedList_psGetNext(LINKEDLIST_ITEM_T *pvItem);
 void *LinkedList_pvPopFront(LINKEDLIST_ITEM_T **ppsFirst);
 void *LinkedList_pvGetStoredItem(LINKEDLIST_ITEM_T *psLLItem);
 
-LINKEDLIST_RESULT_T LinkedList_eLinkedListToArray(LINKEDLIST_ITEM_T **ppsFirst, uint8_t *u8Count);
-
 #endif // LINKEDLIST_H
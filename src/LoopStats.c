@@ -0,0 +1,112 @@
+#include "LoopStats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Globals.h"
+
+#if PINCFG_LOOPSTATS_D
+static uint8_t LoopStats_u8GetBucket(uint32_t u32Us)
+{
+    uint8_t u8Bucket = 0;
+    while (u32Us != 0U && u8Bucket < PINCFG_LOOPSTATS_BUCKETS_D - 1)
+    {
+        u32Us >>= 1;
+        u8Bucket++;
+    }
+
+    return u8Bucket;
+}
+#endif
+
+void LoopStats_vInit(void)
+{
+#if PINCFG_LOOPSTATS_D
+    psGlobals->u32LoopStatsCount = 0U;
+    psGlobals->u32LoopStatsMaxUs = 0U;
+    memset(psGlobals->au32LoopStatsHist, 0, sizeof(psGlobals->au32LoopStatsHist));
+#endif
+}
+
+void LoopStats_vRecord(uint32_t u32Us)
+{
+#if PINCFG_LOOPSTATS_D
+    uint32_t *pu32Bucket = &psGlobals->au32LoopStatsHist[LoopStats_u8GetBucket(u32Us)];
+    if (*pu32Bucket < UINT32_MAX)
+        (*pu32Bucket)++;
+
+    if (psGlobals->u32LoopStatsCount < UINT32_MAX)
+        psGlobals->u32LoopStatsCount++;
+    if (u32Us > psGlobals->u32LoopStatsMaxUs)
+        psGlobals->u32LoopStatsMaxUs = u32Us;
+#else
+    (void)u32Us;
+#endif
+}
+
+uint32_t LoopStats_u32GetP99Us(void)
+{
+#if PINCFG_LOOPSTATS_D
+    uint64_t u64Total = 0U;
+    for (uint8_t b = 0; b < PINCFG_LOOPSTATS_BUCKETS_D; b++)
+        u64Total += psGlobals->au32LoopStatsHist[b];
+
+    // loops above the 99th percentile, the tail is walked from the longest bucket down
+    uint64_t u64Tail = u64Total / 100U;
+    uint64_t u64Seen = 0U;
+    uint8_t u8Bucket = PINCFG_LOOPSTATS_BUCKETS_D - 1;
+    for (; u8Bucket > 0; u8Bucket--)
+    {
+        u64Seen += psGlobals->au32LoopStatsHist[u8Bucket];
+        if (u64Seen > u64Tail)
+            break;
+    }
+
+    // the last bucket is open ended
+    uint32_t u32Upper = (u8Bucket < PINCFG_LOOPSTATS_BUCKETS_D - 1) ? (uint32_t)((1UL << u8Bucket) - 1UL)
+                                                                   : psGlobals->u32LoopStatsMaxUs;
+
+    return (u32Upper < psGlobals->u32LoopStatsMaxUs) ? u32Upper : psGlobals->u32LoopStatsMaxUs;
+#else
+    return 0U;
+#endif
+}
+
+size_t LoopStats_szReadAndReset(char *pcOut, size_t szOutMax)
+{
+    if (pcOut == NULL || szOutMax == 0)
+        return 0;
+
+    pcOut[0] = '\0';
+#if PINCFG_LOOPSTATS_D
+    int iLen = snprintf(
+        pcOut,
+        szOutMax,
+        "N:%lu,MAX:%lu,P99:%lu,H:",
+        (unsigned long)psGlobals->u32LoopStatsCount,
+        (unsigned long)psGlobals->u32LoopStatsMaxUs,
+        (unsigned long)LoopStats_u32GetP99Us());
+
+    uint8_t u8Used = PINCFG_LOOPSTATS_BUCKETS_D;
+    while (u8Used > 1 && psGlobals->au32LoopStatsHist[u8Used - 1] == 0U)
+        u8Used--;
+
+    for (uint8_t b = 0; b < u8Used && iLen > 0 && (size_t)iLen < szOutMax; b++)
+    {
+        iLen += snprintf(
+            &pcOut[iLen],
+            szOutMax - (size_t)iLen,
+            (b == 0) ? "%lu" : ",%lu",
+            (unsigned long)psGlobals->au32LoopStatsHist[b]);
+    }
+
+    LoopStats_vInit();
+
+    if (iLen < 0)
+        return 0;
+
+    return ((size_t)iLen < szOutMax) ? (size_t)iLen : szOutMax - 1;
+#else
+    return 0;
+#endif
+}
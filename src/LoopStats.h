@@ -0,0 +1,23 @@
+#ifndef LOOPSTATS_H
+#define LOOPSTATS_H
+
+#include "Types.h"
+
+// Log2 histogram of PinCfgCsv_vLoop() durations in micros: bucket b counts loops of 2^(b-1) .. 2^b - 1 us,
+// bucket 0 the ones below 1 us. Read and cleared by the CLI command GET_LOOPSTATS.
+
+// "N:<loops>,MAX:<us>,P99:<us>,H:<b0>,<b1>,..." - trailing empty buckets are left out
+#define LOOPSTATS_TEXT_MAX_SZ (48U + PINCFG_LOOPSTATS_BUCKETS_D * 11U)
+
+// clears the statistics, called with memory init
+void LoopStats_vInit(void);
+
+void LoopStats_vRecord(uint32_t u32Us);
+
+// upper bound of the bucket holding the 99th percentile, capped by the maximum
+uint32_t LoopStats_u32GetP99Us(void);
+
+// formats the statistics into pcOut (LOOPSTATS_TEXT_MAX_SZ fits all) and clears them, returns the length
+size_t LoopStats_szReadAndReset(char *pcOut, size_t szOutMax);
+
+#endif // LOOPSTATS_H
@@ -1,39 +1,128 @@
 #include "Memory.h"
 
 #include <errno.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "Globals.h"
 #include "Types.h"
 
-GLOBALS_T *psGlobals = NULL;
+PINCFG_THREAD_LOCAL GLOBALS_T *psGlobals = NULL;
+
+// item arrays and counts of the permanent generation
+static void Memory_vResetItems(void)
+{
+    psGlobals->u16LoopablesCount = 0;
+    psGlobals->u16PresentablesCount = 0;
+    psGlobals->u16LoopablesMax = 0;
+    psGlobals->u16PresentablesMax = 0;
+    psGlobals->ppsLoopables = NULL;
+    psGlobals->ppsPresentables = NULL;
+    psGlobals->pasSwitches = NULL;
+    psGlobals->pasInPins = NULL;
+    psGlobals->u16SwitchesCount = 0;
+    psGlobals->u16SwitchesMax = 0;
+    psGlobals->u16InPinsCount = 0;
+    psGlobals->u16InPinsMax = 0;
+    psGlobals->pcNameNext = NULL;
+    psGlobals->pcNameEnd = NULL;
+#if PINCFG_PROFILER_D
+    psGlobals->pasProfile = NULL;
+#endif
+#if PINCFG_MEMSTATS_D
+    memset(psGlobals->aszMemTagged, 0, sizeof(psGlobals->aszMemTagged));
+    psGlobals->u8MemTag = (uint8_t)MEMORY_TAG_OTHER_E;
+#endif
+}
+
+// permanent allocation of szSize bytes, accounted to the current tag
+static void Memory_vAccount(size_t szSize)
+{
+#if PINCFG_MEMSTATS_D
+    psGlobals->aszMemTagged[psGlobals->u8MemTag] += szSize;
+#else
+    (void)szSize;
+#endif
+}
 
 #ifndef USE_MALLOC
+// Temporary blocks tile [pvMemTempEnd, pvMemEnd) without gaps. Each block starts with this header, which also keeps
+// the size of the block right below it, so a freed block merges with both neighbours without a footer. The lowest
+// block is never free - freeing it gives its memory back to the gap between the two regions.
 typedef struct MEMORY_TEMP_ITEM_S
 {
     union
     {
         struct
         {
-            uint16_t u16AlocatedSize;
-            bool bFree;
+            uint16_t u16Size;      // whole block with the header, MEMORY_TEMP_FREE_F in the unused low bit
+            uint16_t u16LowerSize; // block right below, 0 for the lowest one
         };
         void *pvAligment;
     };
 } MEMORY_TEMP_ITEM_T;
 
+#define MEMORY_TEMP_FREE_F 0x0001U
+// largest block, sizes are multiples of the pointer size
+#define MEMORY_TEMP_BLOCK_MAX_SZ ((size_t)(UINT16_MAX & ~(sizeof(void *) - 1U)))
+// split only when the rest can hold a header and some data
+#define MEMORY_TEMP_SPLIT_MIN_SZ (sizeof(MEMORY_TEMP_ITEM_T) + sizeof(void *))
+
+static size_t Memory_szTempSize(const MEMORY_TEMP_ITEM_T *psItem)
+{
+    return (size_t)(psItem->u16Size & ~MEMORY_TEMP_FREE_F);
+}
+
+static bool Memory_bTempIsFree(const MEMORY_TEMP_ITEM_T *psItem)
+{
+    return (psItem->u16Size & MEMORY_TEMP_FREE_F) != 0U;
+}
+
+// block right above psItem, NULL at the end of the area
+static MEMORY_TEMP_ITEM_T *Memory_psTempUpper(MEMORY_TEMP_ITEM_T *psItem)
+{
+    char *pcUpper = (char *)psItem + Memory_szTempSize(psItem);
+
+    return (pcUpper < psGlobals->pvMemEnd) ? (MEMORY_TEMP_ITEM_T *)pcUpper : NULL;
+}
+
+// psItem got szSize, the block above has to know
+static void Memory_vTempSetSize(MEMORY_TEMP_ITEM_T *psItem, size_t szSize, bool bFree)
+{
+    psItem->u16Size = (uint16_t)(szSize | (bFree ? MEMORY_TEMP_FREE_F : 0U));
+
+    MEMORY_TEMP_ITEM_T *psUpper = Memory_psTempUpper(psItem);
+    if (psUpper != NULL)
+        psUpper->u16LowerSize = (uint16_t)szSize;
+}
+
+// high-water marks after an allocation from either side
+static void Memory_vTrackFree(void)
+{
+#if PINCFG_MEMSTATS_D
+    size_t szFree = (size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext);
+    if (szFree < psGlobals->szMemFreeMin)
+        psGlobals->szMemFreeMin = szFree;
+
+    size_t szTemp = (size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd);
+    if (szTemp > psGlobals->szMemTempMax)
+        psGlobals->szMemTempMax = szTemp;
+#endif
+}
+
 static void Memory_vResetState(void)
 {
     psGlobals->pvMemNext = (char *)psGlobals + sizeof(GLOBALS_T);
     psGlobals->pvMemTempEnd = psGlobals->pvMemNext;
-    psGlobals->u8LoopablesCount = 0;
-    psGlobals->u8PresentablesCount = 0;
-    psGlobals->ppsLoopables = NULL;
-    psGlobals->ppsPresentables = NULL;
+    Memory_vResetItems();
 
     memset(psGlobals->pvMemNext, 0x00U, (size_t)(psGlobals->pvMemEnd - psGlobals->pvMemNext));
 
     Memory_vTempFree();
+#if PINCFG_MEMSTATS_D
+    psGlobals->szMemFreeMin = Memory_szGetFree();
+    psGlobals->szMemTempMax = 0;
+#endif
 }
 
 MEMORY_RESULT_T Memory_eInit(uint8_t *pu8Memory, size_t szSize)
@@ -65,6 +154,19 @@ MEMORY_RESULT_T Memory_eReset(void)
     return MEMORY_OK_E;
 }
 
+MEMORY_RESULT_T Memory_eResetPermanent(void)
+{
+    if (!psGlobals || !psGlobals->bMemIsInitialized)
+        return MEMORY_ERROR_E;
+
+    // temporary allocations sit at the end of the area and stay where they are
+    psGlobals->pvMemNext = (char *)psGlobals + sizeof(GLOBALS_T);
+    Memory_vResetItems();
+    memset(psGlobals->pvMemNext, 0x00U, (size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext));
+
+    return MEMORY_OK_E;
+}
+
 void *Memory_vpAlloc(size_t szSize)
 {
     void *pvResult = NULL;
@@ -94,13 +196,15 @@ void *Memory_vpAlloc(size_t szSize)
 
     pvResult = (void *)psGlobals->pvMemNext;
     psGlobals->pvMemNext = pvNextAfterAllocation;
+    Memory_vAccount(szToAlloc);
+    Memory_vTrackFree();
 
     return pvResult;
 }
 
 void *Memory_vpTempAlloc(size_t szSize)
 {
-    if (!psGlobals->bMemIsInitialized)
+    if (!psGlobals || !psGlobals->bMemIsInitialized)
     {
         errno = ENOMEM;
         return NULL;
@@ -116,6 +220,34 @@ void *Memory_vpTempAlloc(size_t szSize)
     }
 
     size_t szToAlloc = ((szSize + sizeof(MEMORY_TEMP_ITEM_T) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *);
+    if (szToAlloc > MEMORY_TEMP_BLOCK_MAX_SZ)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    // first fit among the freed blocks, the upper part is taken so the rest stays low and can be given back
+    MEMORY_TEMP_ITEM_T *psItem = (psGlobals->pvMemTempEnd < psGlobals->pvMemEnd)
+                                     ? (MEMORY_TEMP_ITEM_T *)psGlobals->pvMemTempEnd
+                                     : NULL;
+    for (; psItem != NULL; psItem = Memory_psTempUpper(psItem))
+    {
+        size_t szItem = Memory_szTempSize(psItem);
+        if (!Memory_bTempIsFree(psItem) || szItem < szToAlloc)
+            continue;
+
+        if (szItem - szToAlloc >= MEMORY_TEMP_SPLIT_MIN_SZ)
+        {
+            Memory_vTempSetSize(psItem, szItem - szToAlloc, true);
+            MEMORY_TEMP_ITEM_T *psTaken = (MEMORY_TEMP_ITEM_T *)((char *)psItem + szItem - szToAlloc);
+            Memory_vTempSetSize(psTaken, szToAlloc, false);
+            psItem = psTaken;
+        }
+        else
+            Memory_vTempSetSize(psItem, szItem, false);
+
+        return (void *)((char *)psItem + sizeof(MEMORY_TEMP_ITEM_T));
+    }
 
     char *pvTempEndAfterAllocation = psGlobals->pvMemTempEnd - szToAlloc;
     if (pvTempEndAfterAllocation < psGlobals->pvMemNext || pvTempEndAfterAllocation >= psGlobals->pvMemTempEnd)
@@ -125,10 +257,12 @@ void *Memory_vpTempAlloc(size_t szSize)
     }
 
     psGlobals->pvMemTempEnd = pvTempEndAfterAllocation;
-    ((MEMORY_TEMP_ITEM_T *)pvTempEndAfterAllocation)->u16AlocatedSize = szToAlloc;
-    ((MEMORY_TEMP_ITEM_T *)pvTempEndAfterAllocation)->bFree = false;
+    psItem = (MEMORY_TEMP_ITEM_T *)pvTempEndAfterAllocation;
+    psItem->u16LowerSize = 0U;
+    Memory_vTempSetSize(psItem, szToAlloc, false);
+    Memory_vTrackFree();
 
-    return (void *)((char *)pvTempEndAfterAllocation + sizeof(MEMORY_TEMP_ITEM_T));
+    return (void *)((char *)psItem + sizeof(MEMORY_TEMP_ITEM_T));
 }
 
 void Memory_vTempFree(void)
@@ -149,44 +283,126 @@ void Memory_vTempFreePt(void *pvToFree)
         return;
 
     MEMORY_TEMP_ITEM_T *psTempItem = (MEMORY_TEMP_ITEM_T *)((char *)pvToFree - sizeof(MEMORY_TEMP_ITEM_T));
-    psTempItem->bFree = true;
+    size_t szItem = Memory_szTempSize(psTempItem);
 
-    // Only coalesce/free from the temp end if this block is at the temp end
-    while ((char *)psTempItem == psGlobals->pvMemTempEnd && psTempItem->bFree)
+    // merge with the free neighbours, a merged block has to fit the header
+    MEMORY_TEMP_ITEM_T *psUpper = Memory_psTempUpper(psTempItem);
+    if (psUpper != NULL && Memory_bTempIsFree(psUpper) &&
+        szItem + Memory_szTempSize(psUpper) <= MEMORY_TEMP_BLOCK_MAX_SZ)
     {
-        size_t szTmp = (size_t)(psTempItem->u16AlocatedSize & 0xFFFFU);
-        memset(psGlobals->pvMemTempEnd, 0x00U, szTmp);
-        psGlobals->pvMemTempEnd += szTmp;
-
-        if (psGlobals->pvMemTempEnd >= psGlobals->pvMemEnd)
+        szItem += Memory_szTempSize(psUpper);
+    }
+    if (psTempItem->u16LowerSize != 0U)
+    {
+        MEMORY_TEMP_ITEM_T *psLower = (MEMORY_TEMP_ITEM_T *)((char *)psTempItem - psTempItem->u16LowerSize);
+        if (Memory_bTempIsFree(psLower) && szItem + Memory_szTempSize(psLower) <= MEMORY_TEMP_BLOCK_MAX_SZ)
         {
-            psGlobals->pvMemTempEnd = psGlobals->pvMemEnd;
-            break;
+            szItem += Memory_szTempSize(psLower);
+            psTempItem = psLower;
         }
-        psTempItem = (MEMORY_TEMP_ITEM_T *)psGlobals->pvMemTempEnd;
+    }
+
+    memset((char *)psTempItem + sizeof(MEMORY_TEMP_ITEM_T), 0x00U, szItem - sizeof(MEMORY_TEMP_ITEM_T));
+    Memory_vTempSetSize(psTempItem, szItem, true);
+
+    // the lowest blocks go back to the gap (more than one only when a merge did not fit the header)
+    while (psGlobals->pvMemTempEnd < psGlobals->pvMemEnd &&
+           Memory_bTempIsFree((MEMORY_TEMP_ITEM_T *)psGlobals->pvMemTempEnd))
+    {
+        szItem = Memory_szTempSize((MEMORY_TEMP_ITEM_T *)psGlobals->pvMemTempEnd);
+        memset(psGlobals->pvMemTempEnd, 0x00U, szItem);
+        psGlobals->pvMemTempEnd += szItem;
+        if (psGlobals->pvMemTempEnd < psGlobals->pvMemEnd)
+            ((MEMORY_TEMP_ITEM_T *)psGlobals->pvMemTempEnd)->u16LowerSize = 0U;
     }
 }
 
+void *Memory_vpTempShrink(void *pvBlock, size_t szSize)
+{
+    if (!psGlobals || !psGlobals->bMemIsInitialized || pvBlock == NULL)
+        return pvBlock;
+
+    MEMORY_TEMP_ITEM_T *psItem = (MEMORY_TEMP_ITEM_T *)((char *)pvBlock - sizeof(MEMORY_TEMP_ITEM_T));
+    size_t szItem = Memory_szTempSize(psItem);
+    size_t szToKeep = ((szSize + sizeof(MEMORY_TEMP_ITEM_T) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *);
+    if (szToKeep >= szItem || szItem - szToKeep < MEMORY_TEMP_SPLIT_MIN_SZ)
+        return pvBlock;
+
+    if ((char *)psItem == psGlobals->pvMemTempEnd)
+    {
+        // the lowest block moves up to its end (or the end of the free block above), the space below goes back to
+        // the gap
+        MEMORY_TEMP_ITEM_T *psUpper = Memory_psTempUpper(psItem);
+        if (psUpper != NULL && Memory_bTempIsFree(psUpper))
+            szItem += Memory_szTempSize(psUpper);
+        MEMORY_TEMP_ITEM_T *psMoved = (MEMORY_TEMP_ITEM_T *)((char *)psItem + szItem - szToKeep);
+        memmove((char *)psMoved + sizeof(MEMORY_TEMP_ITEM_T), pvBlock, szSize);
+        memset(psItem, 0x00U, (size_t)((char *)psMoved - (char *)psItem));
+        psGlobals->pvMemTempEnd = (char *)psMoved;
+        psMoved->u16LowerSize = 0U;
+        Memory_vTempSetSize(psMoved, szToKeep, false);
+
+        return (void *)((char *)psMoved + sizeof(MEMORY_TEMP_ITEM_T));
+    }
+
+    // the rest becomes a used block of its own and is freed to merge with the block above
+    MEMORY_TEMP_ITEM_T *psRest = (MEMORY_TEMP_ITEM_T *)((char *)psItem + szToKeep);
+    Memory_vTempSetSize(psItem, szToKeep, false);
+    psRest->u16LowerSize = (uint16_t)szToKeep;
+    Memory_vTempSetSize(psRest, szItem - szToKeep, false);
+    Memory_vTempFreePt((char *)psRest + sizeof(MEMORY_TEMP_ITEM_T));
+
+    return pvBlock;
+}
+
 size_t Memory_szGetFree(void)
 {
     return (size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext);
 }
 
+size_t Memory_szGetFreeAfterReset(void)
+{
+    return (size_t)(psGlobals->pvMemTempEnd - ((char *)psGlobals + sizeof(GLOBALS_T)));
+}
+
 size_t Memory_szGetAllocatedSize(size_t szSize)
 {
     return (size_t)(((szSize + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *));
 }
 #else // USE_MALLOC
+#include <stddef.h>
 #include <stdlib.h>
 
 #define MEMORY_SZ SIZE_MAX // Use a large value to indicate "unlimited" memory in malloc mode
 
+// header in front of every permanent block, the union keeps the block aligned for any type
+typedef union MEMORY_PERMANENT_HDR_U
+{
+    union MEMORY_PERMANENT_HDR_U *psPrev;
+    max_align_t sAlignment;
+} MEMORY_PERMANENT_HDR_T;
+
+static void Memory_vFreePermanent(void)
+{
+    MEMORY_PERMANENT_HDR_T *psHdr = (MEMORY_PERMANENT_HDR_T *)psGlobals->pvMemPermanent;
+    while (psHdr != NULL)
+    {
+        MEMORY_PERMANENT_HDR_T *psPrev = psHdr->psPrev;
+        free(psHdr);
+        psHdr = psPrev;
+    }
+    psGlobals->pvMemPermanent = NULL;
+}
+
 MEMORY_RESULT_T Memory_eInit(uint8_t *pu8Memory, size_t szSize)
 {
     (void)pu8Memory; // Unused in malloc mode
     (void)szSize;    // Unused in malloc mode
     if (psGlobals != NULL)
+    {
+        Memory_vFreePermanent();
         memset(psGlobals, 0, sizeof(GLOBALS_T));
+    }
     else
     {
         psGlobals = (GLOBALS_T *)malloc(sizeof(GLOBALS_T));
@@ -204,24 +420,46 @@ MEMORY_RESULT_T Memory_eReset(void)
     {
         return MEMORY_ERROR_E;
     }
+    Memory_vFreePermanent();
     memset(psGlobals, 0, sizeof(GLOBALS_T));
 
     return MEMORY_OK_E;
 }
 
+MEMORY_RESULT_T Memory_eResetPermanent(void)
+{
+    if (psGlobals == NULL)
+        return MEMORY_ERROR_E;
+
+    Memory_vFreePermanent();
+    Memory_vResetItems();
+
+    return MEMORY_OK_E;
+}
+
 void *Memory_vpAlloc(size_t szSize)
 {
-    void *pvResult = malloc(szSize);
-    if (pvResult == NULL)
+    MEMORY_PERMANENT_HDR_T *psHdr = (MEMORY_PERMANENT_HDR_T *)malloc(sizeof(MEMORY_PERMANENT_HDR_T) + szSize);
+    if (psHdr == NULL)
     {
         errno = ENOMEM;
+        return NULL;
     }
-    return pvResult;
+    psHdr->psPrev = (MEMORY_PERMANENT_HDR_T *)psGlobals->pvMemPermanent;
+    psGlobals->pvMemPermanent = psHdr;
+    Memory_vAccount(szSize);
+
+    return &psHdr[1];
 }
 
 void *Memory_vpTempAlloc(size_t szSize)
 {
-    return Memory_vpAlloc(szSize);
+    void *pvResult = malloc(szSize);
+    if (pvResult == NULL)
+    {
+        errno = ENOMEM;
+    }
+    return pvResult;
 }
 
 void Memory_vTempFree(void)
@@ -234,15 +472,152 @@ void Memory_vTempFreePt(void *pvToFree)
         free(pvToFree);
 }
 
+void *Memory_vpTempShrink(void *pvBlock, size_t szSize)
+{
+    if (pvBlock == NULL || szSize == 0)
+        return pvBlock;
+
+    void *pvResult = realloc(pvBlock, szSize);
+
+    return (pvResult != NULL) ? pvResult : pvBlock;
+}
+
 size_t Memory_szGetFree(void)
 {
     // In malloc mode, we cannot determine free memory size reliably
     return SIZE_MAX; // Return a large value to indicate "unlimited" free memory
 }
 
+size_t Memory_szGetFreeAfterReset(void)
+{
+    return SIZE_MAX;
+}
+
 size_t Memory_szGetAllocatedSize(size_t szSize)
 {
     // In malloc mode, we return the size as is
     return szSize;
 }
 #endif                     // USE_MALLOC
+
+// name chunk or oversized name, accounted to the names whatever the current tag is
+static char *Memory_pcNameStorageAlloc(size_t szSize)
+{
+#if PINCFG_MEMSTATS_D
+    uint8_t u8Tag = psGlobals->u8MemTag;
+    psGlobals->u8MemTag = (uint8_t)MEMORY_TAG_NAMES_E;
+    char *pcResult = (char *)Memory_vpAlloc(szSize);
+    psGlobals->u8MemTag = u8Tag;
+
+    return pcResult;
+#else
+    return (char *)Memory_vpAlloc(szSize);
+#endif
+}
+
+char *Memory_pcNameAlloc(size_t szLen)
+{
+    if (szLen + 1 > PINCFG_NAME_CHUNK_SZ_D)
+        return Memory_pcNameStorageAlloc(szLen + 1);
+
+    if (psGlobals->pcNameNext == NULL || szLen + 1 > (size_t)(psGlobals->pcNameEnd - psGlobals->pcNameNext))
+    {
+        // the rest of the current chunk is given up, it is shorter than this name
+        char *pcChunk = Memory_pcNameStorageAlloc(PINCFG_NAME_CHUNK_SZ_D);
+        if (pcChunk == NULL)
+            return NULL;
+
+        psGlobals->pcNameNext = pcChunk;
+        psGlobals->pcNameEnd = pcChunk + PINCFG_NAME_CHUNK_SZ_D;
+    }
+
+    char *pcResult = psGlobals->pcNameNext;
+    psGlobals->pcNameNext += szLen + 1;
+
+    return pcResult;
+}
+
+size_t Memory_szGetNameAllocatedSize(size_t szLen, size_t *pszChunkLeft)
+{
+    if (szLen + 1 > PINCFG_NAME_CHUNK_SZ_D)
+        return Memory_szGetAllocatedSize(szLen + 1);
+
+    size_t szResult = 0;
+    if (szLen + 1 > *pszChunkLeft)
+    {
+        szResult = Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D);
+        *pszChunkLeft = PINCFG_NAME_CHUNK_SZ_D;
+    }
+    *pszChunkLeft -= szLen + 1;
+
+    return szResult;
+}
+
+void Memory_vSetTag(MEMORY_TAG_T eTag)
+{
+#if PINCFG_MEMSTATS_D
+    if (eTag < MEMORY_TAG_COUNT_E)
+        psGlobals->u8MemTag = (uint8_t)eTag;
+#else
+    (void)eTag;
+#endif
+}
+
+size_t Memory_szGetTagged(MEMORY_TAG_T eTag)
+{
+#if PINCFG_MEMSTATS_D
+    if (eTag < MEMORY_TAG_COUNT_E)
+        return psGlobals->aszMemTagged[eTag];
+#else
+    (void)eTag;
+#endif
+    return 0;
+}
+
+size_t Memory_szFormatStats(char *pcOut, size_t szOutMax)
+{
+    if (pcOut == NULL || szOutMax == 0)
+        return 0;
+
+    pcOut[0] = '\0';
+#if PINCFG_MEMSTATS_D
+    size_t szUsed = 0;
+    for (uint8_t i = 0; i < MEMORY_TAG_COUNT_E; i++)
+        szUsed += psGlobals->aszMemTagged[i];
+
+    int iLen = snprintf(pcOut, szOutMax, "USED:%lu", (unsigned long)szUsed);
+#ifndef USE_MALLOC
+    if (iLen > 0 && (size_t)iLen < szOutMax)
+    {
+        iLen += snprintf(
+            &pcOut[iLen],
+            szOutMax - (size_t)iLen,
+            ",FREE:%lu,MINFREE:%lu,TMPMAX:%lu",
+            (unsigned long)Memory_szGetFree(),
+            (unsigned long)psGlobals->szMemFreeMin,
+            (unsigned long)psGlobals->szMemTempMax);
+    }
+#endif
+    if (iLen > 0 && (size_t)iLen < szOutMax)
+    {
+        iLen += snprintf(
+            &pcOut[iLen],
+            szOutMax - (size_t)iLen,
+            ",SW:%lu,IN:%lu,TRG:%lu,SR:%lu,NAM:%lu,ARR:%lu,OTH:%lu",
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_SWITCH_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_INPUT_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_TRIGGER_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_SENSOR_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_NAMES_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_ARRAYS_E],
+            (unsigned long)psGlobals->aszMemTagged[MEMORY_TAG_OTHER_E]);
+    }
+
+    if (iLen < 0)
+        return 0;
+
+    return ((size_t)iLen < szOutMax) ? (size_t)iLen : szOutMax - 1;
+#else
+    return 0;
+#endif
+}
@@ -10,13 +10,49 @@ typedef enum MEMORY_RESULT_E
     MEMORY_ERROR_E
 } MEMORY_RESULT_T;
 
+// component type permanent allocations are accounted to
+typedef enum MEMORY_TAG_E
+{
+    MEMORY_TAG_OTHER_E = 0,
+    MEMORY_TAG_ARRAYS_E, // loopables, presentables, profiler
+    MEMORY_TAG_SWITCH_E,
+    MEMORY_TAG_INPUT_E,
+    MEMORY_TAG_TRIGGER_E,
+    MEMORY_TAG_SENSOR_E, // sensors with their measurements
+    MEMORY_TAG_NAMES_E,
+    MEMORY_TAG_COUNT_E
+} MEMORY_TAG_T;
+
+// "USED:<n>,FREE:<n>,MINFREE:<n>,TMPMAX:<n>,SW:<n>,IN:<n>,TRG:<n>,SR:<n>,NAM:<n>,ARR:<n>,OTH:<n>"
+#define MEMORY_STATS_TEXT_MAX_SZ 192U
+
 MEMORY_RESULT_T Memory_eInit(uint8_t *pu8Memory, size_t szSize);
 MEMORY_RESULT_T Memory_eReset(void);
+// Drops all permanent allocations and keeps the temporary ones, the next generation is built over the old one
+MEMORY_RESULT_T Memory_eResetPermanent(void);
 void *Memory_vpAlloc(size_t szSize);
 void *Memory_vpTempAlloc(size_t szSize);
 void Memory_vTempFree(void);
 void Memory_vTempFreePt(void *pvToFree);
+// Gives the end of a temporary block back beyond szSize, returns the block (moved when it was the lowest one)
+void *Memory_vpTempShrink(void *pvBlock, size_t szSize);
 size_t Memory_szGetFree(void);
+// Room of the next generation after Memory_eResetPermanent(), the temporary blocks stay where they are
+size_t Memory_szGetFreeAfterReset(void);
 size_t Memory_szGetAllocatedSize(size_t szSize);
 
+// Permanent allocations from now on are accounted to eTag, names are always accounted to MEMORY_TAG_NAMES_E
+void Memory_vSetTag(MEMORY_TAG_T eTag);
+// Permanent bytes of the current generation accounted to eTag
+size_t Memory_szGetTagged(MEMORY_TAG_T eTag);
+// Arena usage as text for GET_MEM (MEMORY_STATS_TEXT_MAX_SZ fits all), returns the length. FREE, MINFREE and
+// TMPMAX are reported only with the static arena, MINFREE is the smallest gap between the permanent and the
+// temporary region seen since init and TMPMAX the largest temporary region.
+size_t Memory_szFormatStats(char *pcOut, size_t szOutMax);
+
+// Permanent storage for a NUL terminated string of szLen characters, packed without alignment padding
+char *Memory_pcNameAlloc(size_t szLen);
+// Permanent memory the next Memory_pcNameAlloc(szLen) takes, *pszChunkLeft tracks the current chunk
+size_t Memory_szGetNameAllocatedSize(size_t szLen, size_t *pszChunkLeft);
+
 #endif // MEMORY_H
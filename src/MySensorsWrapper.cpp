@@ -22,13 +22,48 @@ extern void hwWriteConfigBlock(void *buf, void *addr, size_t length);
 extern void hwReadConfigBlock(void *buf, void *addr, size_t length);
 #endif
 
+// Child ids are 8-bit, the parser does not hand out ids past PINCFG_CHILD_IDS_MAX_D
+static inline bool bChildIdFits(const uint16_t u16SensorId)
+{
+    return u16SensorId < PINCFG_CHILD_IDS_MAX_D;
+}
+
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+static void vSendQueueRefill(SENDQUEUE_T *psQueue, uint32_t u32ms)
+{
+    uint32_t u32Elapsed = u32ms - psQueue->u32TokensRefilled;
+    if (u32Elapsed < PINCFG_SEND_QUEUE_INTERVAL_MS_D)
+        return;
+
+    uint32_t u32NewTokens = u32Elapsed / PINCFG_SEND_QUEUE_INTERVAL_MS_D;
+    if (u32NewTokens >= (uint32_t)(PINCFG_SEND_QUEUE_BURST_D - psQueue->u8Tokens))
+    {
+        psQueue->u8Tokens = PINCFG_SEND_QUEUE_BURST_D;
+        psQueue->u32TokensRefilled = u32ms;
+    }
+    else
+    {
+        psQueue->u8Tokens += (uint8_t)u32NewTokens;
+        psQueue->u32TokensRefilled += u32NewTokens * PINCFG_SEND_QUEUE_INTERVAL_MS_D;
+    }
+}
+
+static void vSendQueuePopFront(SENDQUEUE_T *psQueue)
+{
+    eSend(&psQueue->asMessages[0], false);
+    psQueue->u8Count--;
+    for (uint8_t i = 0; i < psQueue->u8Count; i++)
+        psQueue->asMessages[i] = psQueue->asMessages[i + 1];
+}
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
     WRAP_RESULT_T eMyMessageInit(
         MyMessage *pcMessage,
-        const uint8_t u8SensorId,
+        const uint16_t u16SensorId,
         const mysensors_data_t eDataType,
         const mysensors_payload_t ePayloadType,
         const char *pcValue)
@@ -36,8 +71,11 @@ extern "C"
         if (pcMessage == NULL)
             return WRAP_NULLPTR_ERROR_E;
 
+        if (!bChildIdFits(u16SensorId))
+            return WRAP_ERROR_E;
+
         pcMessage->clear();
-        pcMessage->setSensor(u8SensorId);
+        pcMessage->setSensor((uint8_t)u16SensorId);
         pcMessage->setType(static_cast<uint8_t>(eDataType));
         switch (ePayloadType)
         {
@@ -75,32 +113,119 @@ extern "C"
         if (message == NULL)
             return WRAP_NULLPTR_ERROR_E;
 
-        if (send(*message, requestEcho))
+        bool bSent = send(*message, requestEcho);
+        if (bSent)
             return WRAP_OK_E;
 
         return WRAP_ERROR_E;
     }
 
-    WRAP_RESULT_T eRequest(const uint8_t childSensorId, const uint8_t variableType, const uint8_t destination)
+    WRAP_RESULT_T eRequest(const uint16_t childSensorId, const uint8_t variableType, const uint8_t destination)
     {
-        if (request(childSensorId, variableType, destination))
+        if (bChildIdFits(childSensorId) && request((uint8_t)childSensorId, variableType, destination))
             return WRAP_OK_E;
 
         return WRAP_ERROR_E;
     }
 
     WRAP_RESULT_T ePresent(
-        const uint8_t sensorId,
+        const uint16_t sensorId,
         const mysensors_sensor_t sensorType,
         const char *description,
         const bool requestEcho)
     {
-        if (present(sensorId, sensorType, description, requestEcho))
+        if (bChildIdFits(sensorId) && present((uint8_t)sensorId, sensorType, description, requestEcho))
             return WRAP_OK_E;
 
         return WRAP_ERROR_E;
     }
 
+    uint16_t u16MessageGetSensorId(const MyMessage *message)
+    {
+        if (message == NULL)
+            return 0;
+
+        return message->sensor;
+    }
+
+    void vSendQueueInit(SENDQUEUE_T *psQueue)
+    {
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+        psQueue->u8Count = 0;
+        psQueue->u8Tokens = PINCFG_SEND_QUEUE_BURST_D;
+        psQueue->u32TokensRefilled = millis();
+#else
+        (void)psQueue;
+#endif
+    }
+
+    WRAP_RESULT_T eSendQueued(SENDQUEUE_T *psQueue, MyMessage *message)
+    {
+        if (psQueue == NULL || message == NULL)
+            return WRAP_NULLPTR_ERROR_E;
+
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+        vSendQueueRefill(psQueue, millis());
+
+        // nothing waiting and radio budget left - no reason to delay
+        if (psQueue->u8Count == 0 && psQueue->u8Tokens > 0)
+        {
+            psQueue->u8Tokens--;
+            return eSend(message, false);
+        }
+
+        // only the latest value of a pending child/type pair is worth sending
+        for (uint8_t i = 0; i < psQueue->u8Count; i++)
+        {
+            MyMessage *psPending = &psQueue->asMessages[i];
+            if (psPending->sensor == message->sensor && psPending->type == message->type &&
+                psPending->sender == message->sender)
+            {
+                *psPending = *message;
+                return WRAP_OK_E;
+            }
+        }
+
+        // overloaded - rather exceed the rate than lose a state change
+        if (psQueue->u8Count == PINCFG_SEND_QUEUE_SZ_D)
+            vSendQueuePopFront(psQueue);
+
+        psQueue->asMessages[psQueue->u8Count++] = *message;
+
+        return WRAP_OK_E;
+#else
+        return eSend(message, false);
+#endif
+    }
+
+    void vSendQueueLoop(SENDQUEUE_T *psQueue, uint32_t u32ms)
+    {
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+        if (psQueue->u8Count == 0)
+            return;
+
+        vSendQueueRefill(psQueue, u32ms);
+        while (psQueue->u8Count > 0 && psQueue->u8Tokens > 0)
+        {
+            psQueue->u8Tokens--;
+            vSendQueuePopFront(psQueue);
+        }
+#else
+        (void)psQueue;
+        (void)u32ms;
+#endif
+    }
+
+    uint8_t u8SendQueueGetCount(const SENDQUEUE_T *psQueue)
+    {
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+        return psQueue->u8Count;
+#else
+        (void)psQueue;
+        return 0;
+#endif
+    }
+
     uint32_t u32Millis()
     {
         return millis();
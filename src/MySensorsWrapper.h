@@ -35,24 +35,45 @@ extern "C"
     } WRAP_RESULT_T;
 
     // MyMessage
+    // sensor ids are presentable ids, ids from PINCFG_CHILD_IDS_MAX_D on are not sent (WRAP_ERROR_E)
     WRAP_RESULT_T eMyMessageInit(
         MyMessage *pcMessage,
-        const uint8_t u8SensorId,
+        const uint16_t u16SensorId,
         const mysensors_data_t eDataType,
         const mysensors_payload_t ePayloadType,
         const char *pcValue);
     uint8_t eMessageGetByte(const MyMessage *message);
+    uint16_t u16MessageGetSensorId(const MyMessage *message);
 
     // MySensorsCore
     WRAP_RESULT_T eSend(MyMessage *message, const bool requestEcho);
-    WRAP_RESULT_T eRequest(const uint8_t childSensorId, const uint8_t variableType, const uint8_t destination);
+    WRAP_RESULT_T eRequest(const uint16_t childSensorId, const uint8_t variableType, const uint8_t destination);
     WRAP_RESULT_T ePresent(
-        const uint8_t sensorId,
+        const uint16_t sensorId,
         const mysensors_sensor_t sensorType,
         const char *description,
         const bool requestEcho);
     void vWait(const uint32_t waitingMS);
 
+    // Rate limited send queue, coalesces pending messages with the same child id and type.
+    // One per pinCfg instance, every instance stands for a node with its own radio budget.
+    typedef struct SENDQUEUE_S
+    {
+#if (PINCFG_SEND_QUEUE_SZ_D > 0)
+        MyMessage asMessages[PINCFG_SEND_QUEUE_SZ_D];
+        uint32_t u32TokensRefilled;
+        uint8_t u8Count;
+        uint8_t u8Tokens;
+#else
+        uint8_t u8Unused;
+#endif
+    } SENDQUEUE_T;
+
+    void vSendQueueInit(SENDQUEUE_T *psQueue);
+    WRAP_RESULT_T eSendQueued(SENDQUEUE_T *psQueue, MyMessage *message);
+    void vSendQueueLoop(SENDQUEUE_T *psQueue, uint32_t u32ms);
+    uint8_t u8SendQueueGetCount(const SENDQUEUE_T *psQueue);
+
     // HAL
     uint32_t u32Millis();
     uint32_t u32Micros();
@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "Memory.h"
 #include "PersistentConfiguration.h"
 
 #define EEPROM_TOTAL_SIZE 1024U
@@ -21,8 +22,9 @@
 // EEPROM Memory Layout - DYNAMIC backup strategy
 // Total available: 611 bytes (1024 - 413 MySensors reserved)
 // Dynamic layout: Block checksums and backup area positioned based on actual config size
-// Layout: [MySensors(413)][CRC16×3(6)][Password(32)][Config(N)][BlockCRC×2(K)][Backup(REST)]
-// Where: N = actual config size, K = 2 × ceil((32+N)/32) block CRCs, REST = remaining space
+// Layout: [MySensors(413)][CRC16×3(6)][Password(32)][Config(N)][BlockCRC×2(K)][Backup(B)][Journal(REST)]
+// Where: N = actual config size, K = 2 × ceil((32+N)/32) block CRCs,
+//        B = min(32+N, remaining space - PINCFG_STATE_JOURNAL_MIN_SZ_D), REST = remaining space
 
 // Data section offsets (relative to start of data area, not EEPROM address)
 #define PINCFG_PASSWORD_OFFSET 0U
@@ -61,15 +63,39 @@ static inline uint16_t getBackupStartAddr(uint16_t u16TotalSize)
     return getBlockChecksumsB1Addr(u16TotalSize) + getNumBlocks(u16TotalSize);
 }
 
+// End of the backup area, the state journal gets at least PINCFG_STATE_JOURNAL_MIN_SZ_D behind it
+#if PINCFG_STATE_JOURNAL_D
+#define EEPROM_BACKUP_END (EEPROM_TOTAL_SIZE - PINCFG_STATE_JOURNAL_MIN_SZ_D)
+#else
+#define EEPROM_BACKUP_END EEPROM_TOTAL_SIZE
+#endif
+
 static inline uint16_t getMaxBackupSize(uint16_t u16TotalSize)
 {
     uint16_t backupStart = getBackupStartAddr(u16TotalSize);
-    return (backupStart < EEPROM_TOTAL_SIZE) ? (EEPROM_TOTAL_SIZE - backupStart) : 0;
+    return (backupStart < EEPROM_BACKUP_END) ? (EEPROM_BACKUP_END - backupStart) : 0;
 }
 
+// Compressed config stream (LZSS, byte aligned so the stored data stays \0 free and \0 terminated):
+// [PACK_MARK] then tokens: 0x01-0x7F literal, 0x80|(len-3) + distance(1-255) copy of len bytes from back then.
+// Distances may reach into _acPackDict which primes the window with common config fragments.
+#define PACK_MARK 0x7FU
+#define PACK_MATCH_FLAG 0x80U
+#define PACK_MIN_MATCH 3U
+#define PACK_MAX_MATCH (PACK_MIN_MATCH + 0x7FU)
+#define PACK_MAX_DIST 0xFFU
+
+static const char _acPackDict[] = "/S,o0/I,i0/T,t0,i0,1,1,o0,0/";
+#define PACK_DICT_LEN ((uint16_t)(sizeof(_acPackDict) - 1U))
+
 // Forward declarations for internal functions
 static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u16Size);
 static PERCFG_RESULT_T eLoad(char *pcDataOut, uint16_t u16Offset);
+static uint16_t u16UnpackedSize(uint16_t u16StoredSize);
+static PERCFG_RESULT_T eUnpack(char *pcCfg, uint16_t u16UnpackedSize);
+#if PINCFG_CONFIG_COMPRESS_D
+static uint16_t u16Pack(const char *pcIn, uint16_t u16InLen, char *pcOut, uint16_t u16OutMax);
+#endif
 
 // Helper function: Scan EEPROM region for null terminator
 // Returns size INCLUDING null terminator, or 0 if not found
@@ -117,8 +143,8 @@ PERCFG_RESULT_T PersistentCfg_eGetConfigSize(uint16_t *pu16ConfigSize)
 
     if (u16SizeWithNull > 0)
     {
-        // Return size of actual data (NOT including null terminator)
-        *pu16ConfigSize = u16SizeWithNull - 1;
+        // Return size of actual (unpacked) data (NOT including null terminator)
+        *pu16ConfigSize = u16UnpackedSize(u16SizeWithNull - 1);
     }
     else
     {
@@ -129,36 +155,181 @@ PERCFG_RESULT_T PersistentCfg_eGetConfigSize(uint16_t *pu16ConfigSize)
     return PERCFG_OK_E;
 }
 
-// CRC16-CCITT (polynomial 0x1021) - detects all 1-2 bit errors and most burst errors
-// Incremental update: process one byte at a time
-static inline void crc16_update(uint16_t *pu16Crc, uint8_t u8Byte)
+PERCFG_RESULT_T PersistentCfg_eGetStoredSize(uint16_t *pu16StoredSize)
+{
+    if (pu16StoredSize == NULL)
+        return PERCFG_ERROR_E;
+
+    *pu16StoredSize = scanForNull(EEPROM_PINCFG, PINCFG_CONFIG_MAX_SZ_D);
+
+    return PERCFG_OK_E;
+}
+
+// CRC16-CCITT (polynomial 0x1021, init 0xFFFF) - detects all 1-2 bit errors and most burst errors
+// CRC8 (polynomial 0x07, init 0xFF) - fast block-level checksums
+// PINCFG_CRC_MODE_D selects how they are computed, all modes give the same values (EEPROM format is the same)
+#if PINCFG_CRC_MODE_D == 1 || PINCFG_CRC_MODE_D == 2
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h>
+#define CRC_TABLE_ATTR PROGMEM
+#define CRC_TABLE_READ16(tab, idx) ((uint16_t)pgm_read_word(&(tab)[(idx)]))
+#define CRC_TABLE_READ8(tab, idx) ((uint8_t)pgm_read_byte(&(tab)[(idx)]))
+#else
+#define CRC_TABLE_ATTR
+#define CRC_TABLE_READ16(tab, idx) ((tab)[(idx)])
+#define CRC_TABLE_READ8(tab, idx) ((tab)[(idx)])
+#endif
+#endif
+
+#if PINCFG_CRC_MODE_D == 1
+// CRC of each nibble value shifted to the top of the register
+static const uint16_t _au16Crc16Nibble[16] CRC_TABLE_ATTR = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static const uint8_t _au8Crc8Nibble[16] CRC_TABLE_ATTR = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+};
+#elif PINCFG_CRC_MODE_D == 2
+// CRC of each byte value shifted to the top of the register
+static const uint16_t _au16Crc16Table[256] CRC_TABLE_ATTR = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+static const uint8_t _au8Crc8Table[256] CRC_TABLE_ATTR = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31,
+    0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65,
+    0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9,
+    0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1,
+    0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2,
+    0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE,
+    0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16,
+    0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42,
+    0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80,
+    0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8,
+    0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C,
+    0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10,
+    0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F,
+    0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B,
+    0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7,
+    0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF,
+    0xFA, 0xFD, 0xF4, 0xF3,
+
+};
+#elif PINCFG_CRC_MODE_D == 3
+// Needs the programmable polynomial of newer STM32 CRC units (the F1 unit is fixed to CRC-32).
+// The unit is reconfigured on each call, so it must not be used from interrupts meanwhile.
+#include <stm32_def.h>
+#if !defined(CRC_POL_POL)
+#error "PINCFG_CRC_MODE_D 3 requires an STM32 CRC unit with programmable polynomial (not available on STM32F1)."
+#endif
+
+static uint32_t u32HwCrc(uint32_t u32PolySize, uint32_t u32Poly, uint32_t u32Init, const uint8_t *data, uint16_t dataSize)
 {
-    *pu16Crc ^= (uint16_t)u8Byte << 8;
-    for (uint8_t bit = 0; bit < 8; ++bit)
+    __HAL_RCC_CRC_CLK_ENABLE();
+    CRC->POL = u32Poly;
+    CRC->INIT = u32Init;
+    CRC->CR = u32PolySize | CRC_CR_RESET; // no input / output reversal
+
+    // byte writes feed 8 bits each, MSB first
+    for (uint16_t i = 0; i < dataSize; ++i)
+        *(volatile uint8_t *)&CRC->DR = data[i];
+
+    return CRC->DR;
+}
+#endif
+
+// Incremental update: process one block at a time
+static inline void crc16_update(uint16_t *pu16Crc, const uint8_t *data, uint16_t dataSize)
+{
+#if PINCFG_CRC_MODE_D == 3
+    *pu16Crc = (uint16_t)u32HwCrc(CRC_CR_POLYSIZE_0, 0x1021, *pu16Crc, data, dataSize);
+#else
+    uint16_t crc = *pu16Crc;
+    for (uint16_t i = 0; i < dataSize; ++i)
     {
-        if (*pu16Crc & 0x8000)
-            *pu16Crc = (*pu16Crc << 1) ^ 0x1021;
-        else
-            *pu16Crc = *pu16Crc << 1;
+#if PINCFG_CRC_MODE_D == 2
+        crc = (uint16_t)(crc << 8) ^ CRC_TABLE_READ16(_au16Crc16Table, (uint8_t)(crc >> 8) ^ data[i]);
+#elif PINCFG_CRC_MODE_D == 1
+        crc = (uint16_t)(crc << 4) ^ CRC_TABLE_READ16(_au16Crc16Nibble, (crc >> 12) ^ (data[i] >> 4));
+        crc = (uint16_t)(crc << 4) ^ CRC_TABLE_READ16(_au16Crc16Nibble, (crc >> 12) ^ (data[i] & 0x0F));
+#else
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            if (crc & 0x8000)
+                crc = (crc << 1) ^ 0x1021;
+            else
+                crc = crc << 1;
+        }
+#endif
     }
+    *pu16Crc = crc;
+#endif
 }
 
 // Block CRC16 calculation using incremental function
 uint16_t crc16(const uint8_t *data, uint16_t dataSize)
 {
     uint16_t crc = 0xFFFF;
-    for (uint16_t i = 0; i < dataSize; ++i)
-        crc16_update(&crc, data[i]);
+    crc16_update(&crc, data, dataSize);
     return crc;
 }
 
 // Fast CRC8 for block-level checksums
 uint8_t crc8(const uint8_t *data, uint16_t dataSize)
 {
+#if PINCFG_CRC_MODE_D == 3
+    return (uint8_t)u32HwCrc(CRC_CR_POLYSIZE_1, 0x07, 0xFF, data, dataSize);
+#else
     uint8_t crc = 0xFF;
 
     for (uint16_t i = 0; i < dataSize; ++i)
     {
+#if PINCFG_CRC_MODE_D == 2
+        crc = CRC_TABLE_READ8(_au8Crc8Table, crc ^ data[i]);
+#elif PINCFG_CRC_MODE_D == 1
+        crc = (uint8_t)(crc << 4) ^ CRC_TABLE_READ8(_au8Crc8Nibble, (crc >> 4) ^ (data[i] >> 4));
+        crc = (uint8_t)(crc << 4) ^ CRC_TABLE_READ8(_au8Crc8Nibble, (crc >> 4) ^ (data[i] & 0x0F));
+#else
         crc ^= data[i];
         for (uint8_t bit = 0; bit < 8; ++bit)
         {
@@ -167,9 +338,11 @@ uint8_t crc8(const uint8_t *data, uint16_t dataSize)
             else
                 crc = crc << 1;
         }
+#endif
     }
 
     return crc;
+#endif
 }
 
 // Calculate block checksums for granular error detection
@@ -184,13 +357,43 @@ void calculateBlockChecksums(const char *pcCfg, uint16_t u16CfgSize, uint8_t *pu
     }
 }
 
+// Write only what differs from the EEPROM content. Blocks are compared against a read back (read is
+// fast, write is expensive) and the span from the first to the last changed block is written in ONE
+// operation, so flash-backed EEPROM commits at most one page update per call and none if nothing changed.
+// Returns true if anything was written.
+static bool bWriteChanged(uint16_t u16EePos, uint16_t u16Size, const char *pcData)
+{
+    uint8_t au8Block[PINCFG_BLOCK_SIZE];
+    uint16_t u16First = u16Size;
+    uint16_t u16End = 0;
+
+    for (uint16_t u16Offset = 0; u16Offset < u16Size; u16Offset += PINCFG_BLOCK_SIZE)
+    {
+        uint16_t u16BlockSize =
+            (u16Offset + PINCFG_BLOCK_SIZE <= u16Size) ? PINCFG_BLOCK_SIZE : (u16Size - u16Offset);
+
+        vHwReadConfigBlock((void *)au8Block, (void *)(uintptr_t)(u16EePos + u16Offset), u16BlockSize);
+        if (memcmp(pcData + u16Offset, au8Block, u16BlockSize) == 0)
+            continue;
+
+        if (u16First == u16Size)
+            u16First = u16Offset;
+        u16End = u16Offset + u16BlockSize;
+    }
+
+    if (u16First == u16Size)
+        return false;
+
+    vHwWriteConfigBlock((void *)(pcData + u16First), (void *)(uintptr_t)(u16EePos + u16First), u16End - u16First);
+    return true;
+}
+
 // Write config to EEPROM optimized for flash paging
-// Writes entire data in ONE operation for optimal flash page utilization
+// Unchanged blocks are skipped, the changed span is written at once and verified
 PERCFG_RESULT_T eWriteCfg(void *iEePos, uint16_t u16CfgSize, const char *pcCfg)
 {
-    // For flash-backed EEPROM: write entire block at once to maximize page efficiency
-    // This is optimal for systems with flash page writes (typically 32-256 bytes)
-    vHwWriteConfigBlock((void *)pcCfg, iEePos, u16CfgSize);
+    if (!bWriteChanged((uint16_t)(uintptr_t)iEePos, u16CfgSize, pcCfg))
+        return PERCFG_OK_E;
 
     // Verify entire write in blocks (read is fast, write is expensive)
     uint16_t u16Offset = 0;
@@ -284,8 +487,7 @@ static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u1
         au8BlockChecksums[u16BlockIdx++] = crc8((const uint8_t *)au8Block, blockSize);
 
         // Update CRC16 incrementally
-        for (uint16_t i = 0; i < blockSize; ++i)
-            crc16_update(&u16CfgCheckSum, au8Block[i]);
+        crc16_update(&u16CfgCheckSum, au8Block, blockSize);
     }
 
     // Process config section - calculate both CRC16 and block CRC8 in one pass
@@ -314,8 +516,7 @@ static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u1
             au8BlockChecksums[u16BlockIdx++] = crc8((const uint8_t *)au8Block, blockSize);
 
             // Update CRC16 incrementally
-            for (uint16_t i = 0; i < blockSize; ++i)
-                crc16_update(&u16CfgCheckSum, au8Block[i]);
+            crc16_update(&u16CfgCheckSum, au8Block, blockSize);
         }
     }
 
@@ -326,9 +527,12 @@ static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u1
     // - If power fails after CRC16: everything consistent → load succeeds
     // ============================================================
 
+    // Every write below goes through bWriteChanged, blocks holding the same bytes are not rewritten.
+    // A small change therefore costs a write of the changed data block(s), their backup copy and the CRCs.
+
     // overwrite node id to force obtain new one
-    uint16_t u16NodeId = AUTO;
-    vHwWriteConfigBlock((void *)&u16NodeId, (void *)(uintptr_t)EEPROM_NODE_ID_ADDRESS, 1u);
+    uint8_t u8NodeId = AUTO;
+    bWriteChanged(EEPROM_NODE_ID_ADDRESS, 1u, (const char *)&u8NodeId);
 
     // STEP 1: Write actual data FIRST
     void *pWriteAddr = (u16Offset == PINCFG_PASSWORD_OFFSET)
@@ -423,7 +627,7 @@ static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u1
     uint8_t au8BlockCrcBoth[PINCFG_MAX_NUM_BLOCKS * 2];
     memcpy(&au8BlockCrcBoth[0], au8BlockChecksums, u16NumBlocks);
     memcpy(&au8BlockCrcBoth[u16NumBlocks], au8BlockChecksums, u16NumBlocks);
-    vHwWriteConfigBlock((void *)au8BlockCrcBoth, (void *)(uintptr_t)u16BlockChkAddr, u16NumBlocks * 2);
+    bWriteChanged(u16BlockChkAddr, u16NumBlocks * 2, (const char *)au8BlockCrcBoth);
 
     // Verify block checksums
     vHwReadConfigBlock((void *)au8Block, (void *)(uintptr_t)u16BlockChkAddr, u16NumBlocks);
@@ -439,7 +643,7 @@ static PERCFG_RESULT_T eSave(const char *pcData, uint16_t u16Offset, uint16_t u1
     memcpy(&au8CrcBlock[0], &u16CfgCheckSum, sizeof(uint16_t));
     memcpy(&au8CrcBlock[2], &u16CfgCheckSum, sizeof(uint16_t));
     memcpy(&au8CrcBlock[4], &u16CfgCheckSum, sizeof(uint16_t));
-    vHwWriteConfigBlock((void *)au8CrcBlock, (void *)EEPROM_PINCFG_CHKSUM, 6);
+    bWriteChanged(EEPROM_PINCFG_CHKSUM, 6, (const char *)au8CrcBlock);
 
     // Verify CRC16 checksums
     vHwReadConfigBlock((void *)au8Block, (void *)(uintptr_t)EEPROM_PINCFG_CHKSUM, 6);
@@ -561,8 +765,7 @@ static PERCFG_RESULT_T eLoad(char *pcDataOut, uint16_t u16Offset)
         au8BlockChecksumsCalculated[u16BlockIdx++] = crc8((const uint8_t *)au8Block, blockSize);
 
         // Update CRC16 incrementally
-        for (uint16_t i = 0; i < blockSize; ++i)
-            crc16_update(&u16CfgCheckSumCalculated, au8Block[i]);
+        crc16_update(&u16CfgCheckSumCalculated, au8Block, blockSize);
     }
 
     bool bIsCfgOk = (u16CfgCheckSumCalculated == u16CfgCheckSum);
@@ -644,8 +847,7 @@ static PERCFG_RESULT_T eLoad(char *pcDataOut, uint16_t u16Offset)
 
             vHwReadConfigBlock((void *)au8Block, (void *)(uintptr_t)(u16BackupStartAddr + offset), blockSize);
 
-            for (uint16_t i = 0; i < blockSize; ++i)
-                crc16_update(&u16BackupCrc, au8Block[i]);
+            crc16_update(&u16BackupCrc, au8Block, blockSize);
         }
 
         // If backup is smaller than total size, we need to include the non-backed-up portion
@@ -663,8 +865,7 @@ static PERCFG_RESULT_T eLoad(char *pcDataOut, uint16_t u16Offset)
 
                 vHwReadConfigBlock((void *)au8Block, pReadAddr, blockSize);
 
-                for (uint16_t i = 0; i < blockSize; ++i)
-                    crc16_update(&u16BackupCrc, au8Block[i]);
+                crc16_update(&u16BackupCrc, au8Block, blockSize);
             }
         }
 
@@ -717,8 +918,7 @@ static PERCFG_RESULT_T eLoad(char *pcDataOut, uint16_t u16Offset)
                 vHwReadConfigBlock((void *)au8Block, pReadAddr, blockSize);
 
                 // Update CRC16 incrementally
-                for (uint16_t i = 0; i < blockSize; ++i)
-                    crc16_update(&u16CfgCheckSumCalculated, au8Block[i]);
+                crc16_update(&u16CfgCheckSumCalculated, au8Block, blockSize);
             }
 
             if (u16CfgCheckSumCalculated == u16CfgCheckSum)
@@ -786,7 +986,11 @@ PERCFG_RESULT_T PersistentCfg_eLoadConfig(char *pcCfg)
     }
 
     // Read config section (null-terminated string starting after password)
+    // stored data is never longer than the unpacked one, so it fits the caller's buffer
     eResult = eLoad(pcCfg, PINCFG_CONFIG_OFFSET);
+    if (eResult == PERCFG_OK_E && (uint8_t)pcCfg[0] == PACK_MARK)
+        return eUnpack(pcCfg, u16ConfigSize);
+
     if (eResult == PERCFG_OK_E)
     {
         // Ensure null termination at end of buffer
@@ -804,7 +1008,31 @@ PERCFG_RESULT_T PersistentCfg_eSaveConfig(const char *pcCfg)
         return PERCFG_ERROR_E;
 
     // Calculate size including null terminator
-    uint16_t u16ConfigSize = strlen(pcCfg) + 1;
+    size_t szConfigSize = strlen(pcCfg) + 1;
+
+    if (szConfigSize > PINCFG_CONFIG_TEXT_MAX_SZ_D)
+        return PERCFG_CFG_BIGGER_THAN_MAX_SZ_E;
+
+    uint16_t u16ConfigSize = (uint16_t)szConfigSize;
+#if PINCFG_CONFIG_COMPRESS_D
+    // Store packed when it is shorter, the buffer is needed only for the duration of the save
+    char *pcPacked = (char *)Memory_vpTempAlloc(u16ConfigSize);
+    if (pcPacked != NULL)
+    {
+        uint16_t u16PackedLen = u16Pack(pcCfg, u16ConfigSize - 1, pcPacked, u16ConfigSize - 1);
+        if (u16PackedLen > 0)
+        {
+            PERCFG_RESULT_T eResult = PERCFG_CFG_BIGGER_THAN_MAX_SZ_E;
+            pcPacked[u16PackedLen] = '\0';
+            if (u16PackedLen + 1 <= PINCFG_CONFIG_MAX_SZ_D)
+                eResult = eSave(pcPacked, PINCFG_CONFIG_OFFSET, u16PackedLen + 1);
+
+            Memory_vTempFreePt(pcPacked);
+            return eResult;
+        }
+        Memory_vTempFreePt(pcPacked);
+    }
+#endif
 
     if (u16ConfigSize > PINCFG_CONFIG_MAX_SZ_D)
         return PERCFG_CFG_BIGGER_THAN_MAX_SZ_E;
@@ -812,3 +1040,276 @@ PERCFG_RESULT_T PersistentCfg_eSaveConfig(const char *pcCfg)
     // Save directly - string is already null-terminated
     return eSave(pcCfg, PINCFG_CONFIG_OFFSET, u16ConfigSize);
 }
+
+// Byte i16Idx of the window, the dictionary precedes the data (negative indexes)
+static inline uint8_t u8PackWindowAt(const char *pcData, int16_t i16Idx)
+{
+    if (i16Idx < 0)
+        return (uint8_t)_acPackDict[PACK_DICT_LEN + i16Idx];
+    return (uint8_t)pcData[i16Idx];
+}
+
+#if PINCFG_CONFIG_COMPRESS_D
+// Greedy LZSS. Returns packed length (including the marker) or 0 if the text does not pack shorter than
+// u16OutMax or contains bytes the format can not carry as literals (>= 0x80).
+static uint16_t u16Pack(const char *pcIn, uint16_t u16InLen, char *pcOut, uint16_t u16OutMax)
+{
+    uint16_t u16Out = 0;
+    uint16_t u16In = 0;
+
+    if (u16OutMax < 1U)
+        return 0;
+    pcOut[u16Out++] = (char)PACK_MARK;
+
+    while (u16In < u16InLen)
+    {
+        if ((uint8_t)pcIn[u16In] >= PACK_MATCH_FLAG)
+            return 0;
+
+        uint16_t u16BestLen = 0;
+        uint16_t u16BestDist = 0;
+        uint16_t u16MaxLen = u16InLen - u16In;
+        if (u16MaxLen > PACK_MAX_MATCH)
+            u16MaxLen = PACK_MAX_MATCH;
+        uint16_t u16MaxDist = u16In + PACK_DICT_LEN;
+        if (u16MaxDist > PACK_MAX_DIST)
+            u16MaxDist = PACK_MAX_DIST;
+
+        for (uint16_t u16Dist = 1; u16Dist <= u16MaxDist && u16BestLen < u16MaxLen; u16Dist++)
+        {
+            int16_t i16From = (int16_t)u16In - (int16_t)u16Dist;
+            uint16_t u16Len = 0;
+            // overlapping copies are fine, the decoder copies byte by byte
+            while (u16Len < u16MaxLen &&
+                   u8PackWindowAt(pcIn, i16From + (int16_t)u16Len) == (uint8_t)pcIn[u16In + u16Len])
+                u16Len++;
+
+            if (u16Len > u16BestLen)
+            {
+                u16BestLen = u16Len;
+                u16BestDist = u16Dist;
+            }
+        }
+
+        if (u16BestLen >= PACK_MIN_MATCH)
+        {
+            if (u16Out + 2U > u16OutMax)
+                return 0;
+            pcOut[u16Out++] = (char)(PACK_MATCH_FLAG | (u16BestLen - PACK_MIN_MATCH));
+            pcOut[u16Out++] = (char)u16BestDist;
+            u16In += u16BestLen;
+        }
+        else
+        {
+            if (u16Out + 1U > u16OutMax)
+                return 0;
+            pcOut[u16Out++] = pcIn[u16In++];
+        }
+    }
+
+    return u16Out;
+}
+#endif // PINCFG_CONFIG_COMPRESS_D
+
+// Size of the config once unpacked - walks the stored tokens in EEPROM, no window needed
+static uint16_t u16UnpackedSize(uint16_t u16StoredSize)
+{
+    uint8_t au8Block[PINCFG_BLOCK_SIZE];
+    uint16_t u16Size = 0;
+    bool bDistNext = false;
+
+    for (uint16_t offset = 0; offset < u16StoredSize; offset += PINCFG_BLOCK_SIZE)
+    {
+        uint16_t blockSize =
+            (offset + PINCFG_BLOCK_SIZE <= u16StoredSize) ? PINCFG_BLOCK_SIZE : (u16StoredSize - offset);
+        vHwReadConfigBlock((void *)au8Block, (void *)(uintptr_t)(EEPROM_PINCFG + offset), blockSize);
+
+        uint16_t i = 0;
+        if (offset == 0)
+        {
+            if (au8Block[0] != PACK_MARK)
+                return u16StoredSize; // plain text
+            i = 1;
+        }
+
+        for (; i < blockSize; i++)
+        {
+            if (bDistNext)
+                bDistNext = false;
+            else if (au8Block[i] & PACK_MATCH_FLAG)
+            {
+                u16Size += (au8Block[i] & (uint8_t)~PACK_MATCH_FLAG) + PACK_MIN_MATCH;
+                bDistNext = true;
+            }
+            else
+                u16Size++;
+        }
+    }
+
+    return u16Size;
+}
+
+// Unpacks the stored stream in place: moves it to the end of the buffer and decodes towards the front.
+// The writer never overtakes the reader as every token produces at least as many bytes as it takes.
+static PERCFG_RESULT_T eUnpack(char *pcCfg, uint16_t u16UnpackedSize)
+{
+    uint16_t u16PackedLen = strlen(pcCfg) - 1; // without marker
+    if (u16PackedLen > u16UnpackedSize)
+        return PERCFG_INVALID_E;
+
+    uint16_t u16In = u16UnpackedSize - u16PackedLen;
+    uint16_t u16Out = 0;
+    memmove(pcCfg + u16In, pcCfg + 1, u16PackedLen);
+
+    while (u16In < u16UnpackedSize)
+    {
+        uint8_t u8Token = (uint8_t)pcCfg[u16In++];
+        if ((u8Token & PACK_MATCH_FLAG) == 0U)
+        {
+            pcCfg[u16Out++] = (char)u8Token;
+            continue;
+        }
+
+        if (u16In >= u16UnpackedSize)
+            return PERCFG_INVALID_E;
+        uint16_t u16Len = (u8Token & (uint8_t)~PACK_MATCH_FLAG) + PACK_MIN_MATCH;
+        uint16_t u16Dist = (uint8_t)pcCfg[u16In++];
+        if (u16Dist == 0U || u16Dist > u16Out + PACK_DICT_LEN || u16Out + u16Len > u16In)
+            return PERCFG_INVALID_E;
+
+        int16_t i16From = (int16_t)u16Out - (int16_t)u16Dist;
+        for (uint16_t i = 0; i < u16Len; i++)
+            pcCfg[u16Out++] = (char)u8PackWindowAt(pcCfg, i16From + (int16_t)i);
+    }
+
+    pcCfg[u16Out] = '\0';
+    return PERCFG_OK_E;
+}
+
+#if PINCFG_STATE_JOURNAL_D
+// State journal record: [sequence][config CRC16 lo][hi][state (u8Size)][CRC8 of the preceding bytes]
+// Records are appended to the next slot, the newest is the one with the highest sequence (modulo 256).
+#define JOURNAL_HDR_SZ 3U
+#define JOURNAL_REC_OVERHEAD (JOURNAL_HDR_SZ + 1U)
+#define JOURNAL_MAX_SLOTS 127U // keeps the sequence comparison modulo 256 unambiguous
+
+// Stored config CRC16 by majority, nothing is repaired here (eLoad does that)
+static uint16_t u16JournalCfgCrc(void)
+{
+    uint16_t au16Crc[3];
+    vHwReadConfigBlock((void *)au16Crc, (void *)(uintptr_t)EEPROM_PINCFG_CHKSUM, sizeof(au16Crc));
+    if (au16Crc[0] == au16Crc[1] || au16Crc[0] == au16Crc[2])
+        return au16Crc[0];
+    return au16Crc[1];
+}
+
+// Journal starts right behind the backup of the stored config, returns number of u8RecSz slots
+static uint16_t u16JournalSlots(uint8_t u8RecSz, uint16_t *pu16Addr)
+{
+    uint16_t u16TotalSize = PINCFG_CONFIG_OFFSET + scanForNull(EEPROM_PINCFG, PINCFG_CONFIG_MAX_SZ_D);
+    uint16_t u16Addr = getBackupStartAddr(u16TotalSize) + getBackupSize(u16TotalSize);
+
+    *pu16Addr = u16Addr;
+    if (u16Addr >= EEPROM_TOTAL_SIZE)
+        return 0;
+
+    uint16_t u16Slots = (EEPROM_TOTAL_SIZE - u16Addr) / u8RecSz;
+    return (u16Slots > JOURNAL_MAX_SLOTS) ? JOURNAL_MAX_SLOTS : u16Slots;
+}
+
+// Newest valid record of the stored config into pu8Rec, returns its slot or -1 if there is none
+static int16_t i16JournalNewest(uint16_t u16Addr, uint16_t u16Slots, uint8_t u8RecSz, uint8_t *pu8Rec)
+{
+    uint8_t au8Rec[PERCFG_STATE_MAX_SZ + JOURNAL_REC_OVERHEAD];
+    uint16_t u16CfgCrc = u16JournalCfgCrc();
+    int16_t i16Newest = -1;
+
+    for (uint16_t u16Slot = 0; u16Slot < u16Slots; u16Slot++)
+    {
+        vHwReadConfigBlock((void *)au8Rec, (void *)(uintptr_t)(u16Addr + u16Slot * u8RecSz), u8RecSz);
+
+        if (crc8(au8Rec, u8RecSz - 1U) != au8Rec[u8RecSz - 1U] ||
+            (uint16_t)(au8Rec[1] | ((uint16_t)au8Rec[2] << 8)) != u16CfgCrc)
+            continue;
+
+        if (i16Newest < 0 || (int8_t)(au8Rec[0] - pu8Rec[0]) > 0)
+        {
+            i16Newest = (int16_t)u16Slot;
+            memcpy(pu8Rec, au8Rec, u8RecSz);
+        }
+    }
+
+    return i16Newest;
+}
+
+PERCFG_RESULT_T PersistentCfg_eReadState(uint8_t *pu8State, uint8_t u8Size)
+{
+    if (pu8State == NULL)
+        return PERCFG_ERROR_E;
+    if (u8Size == 0U || u8Size > PERCFG_STATE_MAX_SZ)
+        return PERCFG_OUT_OF_RANGE_E;
+
+    uint8_t au8Rec[PERCFG_STATE_MAX_SZ + JOURNAL_REC_OVERHEAD];
+    uint8_t u8RecSz = u8Size + JOURNAL_REC_OVERHEAD;
+    uint16_t u16Addr;
+    uint16_t u16Slots = u16JournalSlots(u8RecSz, &u16Addr);
+
+    if (i16JournalNewest(u16Addr, u16Slots, u8RecSz, au8Rec) < 0)
+        return PERCFG_READ_FAILED_E;
+
+    memcpy(pu8State, &au8Rec[JOURNAL_HDR_SZ], u8Size);
+    return PERCFG_OK_E;
+}
+
+PERCFG_RESULT_T PersistentCfg_eWriteState(const uint8_t *pu8State, uint8_t u8Size)
+{
+    if (pu8State == NULL)
+        return PERCFG_ERROR_E;
+    if (u8Size == 0U || u8Size > PERCFG_STATE_MAX_SZ)
+        return PERCFG_OUT_OF_RANGE_E;
+
+    uint8_t au8Rec[PERCFG_STATE_MAX_SZ + JOURNAL_REC_OVERHEAD];
+    uint8_t u8RecSz = u8Size + JOURNAL_REC_OVERHEAD;
+    uint16_t u16Addr;
+    uint16_t u16Slots = u16JournalSlots(u8RecSz, &u16Addr);
+
+    // two slots at least, so an interrupted write always leaves the previous record intact
+    if (u16Slots < 2U)
+        return PERCFG_CFG_BIGGER_THAN_MAX_SZ_E;
+
+    uint16_t u16Slot = 0;
+    uint8_t u8Seq = 0;
+    int16_t i16Newest = i16JournalNewest(u16Addr, u16Slots, u8RecSz, au8Rec);
+    if (i16Newest >= 0)
+    {
+        if (memcmp(&au8Rec[JOURNAL_HDR_SZ], pu8State, u8Size) == 0)
+            return PERCFG_OK_E;
+
+        u16Slot = ((uint16_t)i16Newest + 1U) % u16Slots;
+        u8Seq = au8Rec[0] + 1U;
+    }
+
+    uint16_t u16CfgCrc = u16JournalCfgCrc();
+    au8Rec[0] = u8Seq;
+    au8Rec[1] = (uint8_t)u16CfgCrc;
+    au8Rec[2] = (uint8_t)(u16CfgCrc >> 8);
+    memcpy(&au8Rec[JOURNAL_HDR_SZ], pu8State, u8Size);
+    au8Rec[u8RecSz - 1U] = crc8(au8Rec, u8RecSz - 1U);
+
+    return eWriteCfg((void *)(uintptr_t)(u16Addr + u16Slot * u8RecSz), u8RecSz, (const char *)au8Rec);
+}
+#else
+PERCFG_RESULT_T PersistentCfg_eReadState(uint8_t *pu8State, uint8_t u8Size)
+{
+    (void)pu8State;
+    (void)u8Size;
+    return PERCFG_ERROR_E;
+}
+
+PERCFG_RESULT_T PersistentCfg_eWriteState(const uint8_t *pu8State, uint8_t u8Size)
+{
+    (void)pu8State;
+    (void)u8Size;
+    return PERCFG_ERROR_E;
+}
+#endif // PINCFG_STATE_JOURNAL_D
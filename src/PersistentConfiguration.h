@@ -21,6 +21,8 @@ typedef enum
 } PERCFG_RESULT_T;
 
 PERCFG_RESULT_T PersistentCfg_eGetConfigSize(uint16_t *pu16CfgSize);
+// EEPROM bytes the stored config takes (packed size when it is stored compressed), terminator included, 0 if none
+PERCFG_RESULT_T PersistentCfg_eGetStoredSize(uint16_t *pu16StoredSize);
 
 // Password read/write - work with 32-byte binary SHA-256 hash
 PERCFG_RESULT_T PersistentCfg_eReadPassword(uint8_t *pu8PasswordOut);
@@ -31,12 +33,21 @@ PERCFG_RESULT_T PersistentCfg_eLoadConfig(char *pcCfg);
 
 PERCFG_RESULT_T PersistentCfg_eSaveConfig(const char *pcCfg);
 
+// Runtime state journal - append only records wear leveled over the EEPROM behind the config backup.
+// A record is bound to the stored config (its CRC16) and size, records of other configs are never returned.
+#define PERCFG_STATE_MAX_SZ 32U
+PERCFG_RESULT_T PersistentCfg_eReadState(uint8_t *pu8State, uint8_t u8Size);
+// does not write anything if the newest record holds the same state
+PERCFG_RESULT_T PersistentCfg_eWriteState(const uint8_t *pu8State, uint8_t u8Size);
+
 // Internal functions exposed for unit testing only
 // These work with full config including password - DO NOT use in application code
 #ifdef UNIT_TEST
 PERCFG_RESULT_T PersistentCfg_eGetSize(uint16_t *pu16CfgSize);
 PERCFG_RESULT_T PersistentCfg_eSave(const char *pcCfg);
 PERCFG_RESULT_T PersistentCfg_eLoad(char *pcCfg);
+uint16_t crc16(const uint8_t *data, uint16_t dataSize);
+uint8_t crc8(const uint8_t *data, uint16_t dataSize);
 #endif
 
 #endif // PERSISTENTCONFIGURATION_H
\ No newline at end of file
@@ -7,9 +7,11 @@
 
 #include "CPUTempMeasure.h"
 #include "Cli.h"
+#include "CompositeTrigger.h"
 #include "Event.h"
 #include "Globals.h"
 #include "InPin.h"
+#include "LoopStats.h"
 #include "LoopTimeMeasure.h"
 #include "Memory.h"
 #include "MySensorsWrapper.h"
@@ -17,9 +19,13 @@
 #include "PinCfgMessages.h"
 #include "PinCfgParse.h"
 #include "PinCfgStr.h"
+#include "PinCfgUtils.h"
+#include "Profiler.h"
 #include "Sensor.h"
 #include "SensorMeasure.h"
+#include "StateJournal.h"
 #include "Switch.h"
+#include "Trace.h"
 #include "Trigger.h"
 
 #ifdef PINCFG_FEATURE_I2C_MEASUREMENT
@@ -38,11 +44,31 @@
 #include "SPIMeasure.h"
 #endif
 
+// presentable of the replaced config, kept in temporary memory while the new one is built
+typedef struct PINCFG_RELOAD_ITEM_S
+{
+    const char *pcName; // copy, the original is gone with the old generation
+    uint16_t u16Id;
+    uint8_t u8SType;
+    uint8_t u8VType;
+    uint8_t u8Flags;
+    uint8_t u8State;
+} PINCFG_RELOAD_ITEM_T;
+
 // Forward declarations
+static PINCFG_RESULT_T PinCfgCsv_eAllocItemArrays(PINCFG_PARSE_PARAMS_T *psParams);
+static PINCFG_RESULT_T PinCfgCsv_eAllocArrays(
+    uint16_t u16Loopables,
+    uint16_t u16Presentables,
+    uint16_t u16Switches,
+    uint16_t u16InPins);
+static PINCFG_RESULT_T PinCfgCsv_eCreateStatic(const PINCFG_STATIC_CFG_T *psCfgSrc);
+static PINCFG_RESULT_T PinCfgCsv_eParseConfig(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 static PINCFG_RESULT_T PinCfgCsv_CreateCli(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 static PINCFG_RESULT_T PinCfgCsv_ParseSwitch(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 static PINCFG_RESULT_T PinCfgCsv_ParseInpins(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 static PINCFG_RESULT_T PinCfgCsv_ParseTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
+static PINCFG_RESULT_T PinCfgCsv_ParseCompositeTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 
 // Phase 2: Measurement source and sensor reporter parsers
 static PINCFG_RESULT_T PinCfgCsv_ParseMeasurementSource(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
@@ -51,8 +77,12 @@ static PINCFG_RESULT_T PinCfgCsv_eAddToLinkedList(LINKEDLIST_ITEM_T **psFirst, v
 
 static PINCFG_RESULT_T PinCfgCsv_ParseGlobalConfigItems(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms);
 
-static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesById(uint8_t u8Id);
-static PRESENTABLE_T *PinCfgCsv_psFindInTempPresentablesByName(const STRING_POINT_T *psName);
+static void PinCfgCsv_vInitTypes(void);
+static void PinCfgCsv_vReloadFromLoop(void);
+static void PinCfgCsv_vCarryOver(const PINCFG_RELOAD_ITEM_T *pasOld, uint16_t u16OldCount);
+
+static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesById(uint16_t u16Id);
+static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesByName(const STRING_POINT_T *psName);
 static ISENSORMEASURE_T *PinCfgCsv_psFindMeasurementByName(
     PINCFG_PARSE_SUBFN_PARAMS_T *psPrms,
     const STRING_POINT_T *psName);
@@ -130,6 +160,15 @@ static void *pvAllocOrOOM(
     PINCFG_PARSE_STRINGS_T eComponentType,
     PINCFG_RESULT_T *peResult)
 {
+    // what the component allocates next (e.g. a sensor's enableable) is accounted to the same type
+    switch (eComponentType)
+    {
+    case TRG_E: Memory_vSetTag(MEMORY_TAG_TRIGGER_E); break;
+    case SR_E:
+    case MS_E: Memory_vSetTag(MEMORY_TAG_SENSOR_E); break;
+    default: Memory_vSetTag(MEMORY_TAG_OTHER_E); break;
+    }
+
     void *pvAlloc = Memory_vpAlloc(szSize);
     if (pvAlloc == NULL)
     {
@@ -152,7 +191,7 @@ static bool bRegisterComponent(
     {
         if (psPrms->psParsePrms->eAddToPresentables(psPresentable) == PINCFG_OK_E)
         {
-            psPrms->u8PresentablesCount++;
+            psPrms->u16PresentablesCount++;
         }
         else
         {
@@ -193,6 +232,34 @@ __attribute__((unused)) static size_t szLogWarningExt(
         pcSuffix);
 }
 
+// Presentables are numbered in config order in every pass, a config that runs out of MySensors child ids is
+// rejected - ids past PINCFG_CHILD_IDS_MAX_D could be presented but never controlled
+static bool bTakeChildIds(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms, uint8_t u8Count, PINCFG_PARSE_STRINGS_T eComponentType)
+{
+    if ((uint32_t)psPrms->u16ChildIds + u8Count > PINCFG_CHILD_IDS_MAX_D)
+    {
+        psPrms->pcOutStringLast +=
+            LOG_ERROR(psPrms, PinCfgMessages_getString(eComponentType), ERR_TOO_MANY_CHILD_IDS);
+        return false;
+    }
+    psPrms->u16ChildIds += u8Count;
+
+    return true;
+}
+
+// Count presentables and loopables of the sizing pass and add their slots in the final arrays
+static void vAddItemsRequirement(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms, uint8_t u8Presentables, uint8_t u8Loopables)
+{
+    if (psPrms->psParsePrms->eAddToPresentables == NULL)
+        u8Presentables = 0U;
+    if (psPrms->psParsePrms->eAddToLoopables == NULL)
+        u8Loopables = 0U;
+
+    psPrms->u16PresentablesRequired += u8Presentables;
+    psPrms->u16LoopablesRequired += u8Loopables;
+    *(psPrms->psParsePrms->pszMemoryRequired) += sizeof(void *) * ((size_t)u8Presentables + (size_t)u8Loopables);
+}
+
 // Calculate and add memory requirement for a component
 static void vAddMemoryRequirement(
     PINCFG_PARSE_SUBFN_PARAMS_T *psPrms,
@@ -205,58 +272,113 @@ static void vAddMemoryRequirement(
         return;
 
     *(psPrms->psParsePrms->pszMemoryRequired) +=
-        Memory_szGetAllocatedSize(szStructSize) + Memory_szGetAllocatedSize(szNameLen + 1);
+        Memory_szGetAllocatedSize(szStructSize) + Memory_szGetNameAllocatedSize(szNameLen, &psPrms->szNameChunkLeft);
 
-    if (bAddPresentable && psPrms->psParsePrms->eAddToPresentables != NULL)
-        *(psPrms->psParsePrms->pszMemoryRequired) +=
-            Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-
-    if (bAddLoopable && psPrms->psParsePrms->eAddToLoopables != NULL)
-        *(psPrms->psParsePrms->pszMemoryRequired) +=
-            Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    vAddItemsRequirement(psPrms, bAddPresentable ? 1U : 0U, bAddLoopable ? 1U : 0U);
 }
 
 // ============================================================================
 
+static void PinCfgCsv_vPresentationLoop(uint32_t u32ms)
+{
+    if (psGlobals->u8PresentationState == PINCFG_PRESENTATION_IDLE_E ||
+        PinCfg_u32GetElapsedTime(psGlobals->u32PresentationSlotMs, u32ms) < PINCFG_PRESENTATION_INTERVAL_MS_D)
+        return;
+
+    if (psGlobals->u8PresentationState == PINCFG_PRESENTATION_PRESENTING_E)
+    {
+        // after a reload only the changed children are pending
+        while (psGlobals->u16PresentationIdx < psGlobals->u16PresentablesCount)
+        {
+            PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[psGlobals->u16PresentationIdx++];
+            if (!(psCurrent->u8Flags & PRESENTABLE_FLAG_PRESENT_PENDING))
+                continue;
+
+            psCurrent->u8Flags &= ~PRESENTABLE_FLAG_PRESENT_PENDING;
+            psCurrent->psVtab->vPresent(psCurrent);
+            psGlobals->u32PresentationSlotMs = u32ms;
+            return;
+        }
+
+        psGlobals->u16PresentationIdx = 0;
 #ifdef MY_CONTROLLER_HA
-static bool bInitialValueSent = false;
+        psGlobals->u8PresentationState = PINCFG_PRESENTATION_INITIAL_STATES_E;
+#else
+        psGlobals->u8PresentationState = PINCFG_PRESENTATION_IDLE_E;
+        return;
 #endif
+    }
 
-void PinCfgCsv_vLoop(uint32_t u32ms)
-{
 #ifdef MY_CONTROLLER_HA
-    if (!bInitialValueSent)
+    // keep cycling over items the controller has not acknowledged yet
+    for (uint8_t u8Pass = 0; u8Pass < 2; u8Pass++)
     {
-        bool bAllPresented = true;
-        for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
+        for (; psGlobals->u16PresentationIdx < psGlobals->u16PresentablesCount; psGlobals->u16PresentationIdx++)
         {
-            PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[i];
+            PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[psGlobals->u16PresentationIdx];
             if (!(psCurrent->u8Flags & PRESENTABLE_FLAG_STATE_PRESENTED))
             {
                 Presentable_vPresentState(psCurrent);
-                vWait(50);
-                bAllPresented = false;
+                psGlobals->u16PresentationIdx++;
+                psGlobals->u32PresentationSlotMs = u32ms;
+                return;
             }
         }
-        if (bAllPresented)
-            bInitialValueSent = true;
+        psGlobals->u16PresentationIdx = 0;
     }
+
+    psGlobals->u8PresentationState = PINCFG_PRESENTATION_IDLE_E;
+#endif
+}
+
+void PinCfgCsv_vLoop(uint32_t u32ms)
+{
+#if PINCFG_LOOPSTATS_D
+    uint32_t u32StartUs = u32Micros();
 #endif
 
-    for (uint8_t i = 0; i < psGlobals->u8LoopablesCount; i++)
+    // between two passes nothing of the replaced config is on the stack
+    if (psGlobals->bReloadPending)
+        PinCfgCsv_vReloadFromLoop();
+
+    PinCfgCsv_vPresentationLoop(u32ms);
+
+#if PINCFG_PROFILER_D
+    Profiler_vLoopAll(u32ms);
+#else
+    for (uint16_t i = 0; i < psGlobals->u16LoopablesCount; i++)
     {
         LOOPABLE_T *psCurrent = psGlobals->ppsLoopables[i];
         psCurrent->vLoop(psCurrent, u32ms);
     }
+
+    // outputs last, so everything that drives them in this pass is already applied
+    InPin_vLoopAll(psGlobals->pasInPins, psGlobals->u16InPinsCount, u32ms);
+    Switch_vLoopAll(psGlobals->pasSwitches, psGlobals->u16SwitchesCount, u32ms);
+#endif
+
+    vSendQueueLoop(&psGlobals->sSendQueue, u32ms);
+    StateJournal_vLoop(u32ms);
+
+#if PINCFG_LOOPSTATS_D
+    LoopStats_vRecord(u32Micros() - u32StartUs);
+#endif
 }
 
 void PinCfgCsv_vPresentation(void)
 {
-    for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
-    {
-        psGlobals->ppsPresentables[i]->psVtab->vPresent(psGlobals->ppsPresentables[i]);
-        vWait(50);
-    }
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+        psGlobals->ppsPresentables[i]->u8Flags |= PRESENTABLE_FLAG_PRESENT_PENDING;
+
+    psGlobals->u8PresentationState = PINCFG_PRESENTATION_PRESENTING_E;
+    psGlobals->u16PresentationIdx = 0;
+    psGlobals->u32PresentationSlotMs = u32Millis() - PINCFG_PRESENTATION_INTERVAL_MS_D;
+    PinCfgCsv_vPresentationLoop(u32Millis());
+}
+
+bool PinCfgCsv_bPresentationDone(void)
+{
+    return psGlobals->u8PresentationState == PINCFG_PRESENTATION_IDLE_E;
 }
 
 void PinCfgCsv_vReceiveMessage(const MyMessage *message)
@@ -264,8 +386,8 @@ void PinCfgCsv_vReceiveMessage(const MyMessage *message)
     if (psGlobals == NULL)
         return;
 
-    // Access MyMessage struct fields directly (C-compatible)
-    PRESENTABLE_T *psReceiver = PinCfgCsv_psFindInPresentablesById(message->sensor);
+    // child id and destination node resolve to the logical id
+    PRESENTABLE_T *psReceiver = PinCfgCsv_psFindInPresentablesById(u16MessageGetSensorId(message));
     if (psReceiver == NULL)
         return;
 
@@ -295,6 +417,123 @@ PINCFG_RESULT_T PinCfgCsv_eValidate(
     return PinCfgCsv_eParse(&sParseParams);
 }
 
+// component name of a config line, global items are keyed by their type, comments have none
+static bool PinCfgCsv_bGetLineKey(const STRING_POINT_T *psLine, STRING_POINT_T *psKey)
+{
+    if (psLine->szLen == 0 || psLine->pcStrStart[0] == '#')
+        return false;
+
+    *psKey = *psLine;
+    PinCfgStr_vGetSplitElemByIndex(psKey, PINCFG_VALUE_SEPARATOR_D, 0);
+    if (psKey->szLen == 2 && psKey->pcStrStart[0] == 'C')
+        return true;
+
+    // measurement sources carry their type first
+    size_t szNameIdx = (psKey->szLen == 2 && psKey->pcStrStart[0] == 'M' && psKey->pcStrStart[1] == 'S') ? 2 : 1;
+    if (PinCfgStr_szGetSplitCount(psLine, PINCFG_VALUE_SEPARATOR_D) <= szNameIdx)
+        return false;
+
+    *psKey = *psLine;
+    PinCfgStr_vGetSplitElemByIndex(psKey, PINCFG_VALUE_SEPARATOR_D, szNameIdx);
+
+    return psKey->szLen > 0;
+}
+
+static bool PinCfgCsv_bFindLine(
+    const char *pcCfg,
+    size_t szCfgLen,
+    const STRING_POINT_T *psKey,
+    size_t *pszLineStart,
+    size_t *pszLineLen)
+{
+    size_t szStart = 0;
+    while (szStart < szCfgLen)
+    {
+        const char *pcEnd = (const char *)memchr(&pcCfg[szStart], PINCFG_LINE_SEPARATOR_D, szCfgLen - szStart);
+        size_t szLineLen = (pcEnd != NULL) ? (size_t)(pcEnd - &pcCfg[szStart]) : szCfgLen - szStart;
+        STRING_POINT_T sLine;
+        STRING_POINT_T sKey;
+
+        PinCfgStr_vInitStrPoint(&sLine, &pcCfg[szStart], szLineLen);
+        if (PinCfgCsv_bGetLineKey(&sLine, &sKey) && sKey.szLen == psKey->szLen &&
+            memcmp(sKey.pcStrStart, psKey->pcStrStart, sKey.szLen) == 0)
+        {
+            *pszLineStart = szStart;
+            *pszLineLen = szLineLen;
+            return true;
+        }
+        szStart += szLineLen + 1;
+    }
+
+    return false;
+}
+
+PINCFG_RESULT_T PinCfgCsv_ePatch(const char *pcConfig, const char *pcPatch, char *pcOut, size_t szOutMax)
+{
+    if (pcConfig == NULL || pcPatch == NULL || pcOut == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    size_t szLen = strlen(pcConfig);
+    if (szLen + 1 > szOutMax)
+        return PINCFG_MAXLEN_ERROR_E;
+    memmove(pcOut, pcConfig, szLen + 1);
+
+    STRING_POINT_T sPatch;
+    PinCfgStr_vInitStrPoint(&sPatch, pcPatch, strlen(pcPatch));
+    size_t szEdits = PinCfgStr_szGetSplitCount(&sPatch, PINCFG_LINE_SEPARATOR_D);
+    for (size_t i = 0; i < szEdits; i++)
+    {
+        STRING_POINT_T sEdit = sPatch;
+        STRING_POINT_T sKey;
+        PinCfgStr_vGetSplitElemByIndex(&sEdit, PINCFG_LINE_SEPARATOR_D, i);
+        if (sEdit.szLen == 0)
+            continue;
+
+        bool bDelete = (sEdit.pcStrStart[0] == '-');
+        if (bDelete)
+            PinCfgStr_vInitStrPoint(&sKey, sEdit.pcStrStart + 1, sEdit.szLen - 1);
+        if ((bDelete && sKey.szLen == 0) || (!bDelete && !PinCfgCsv_bGetLineKey(&sEdit, &sKey)))
+            return PINCFG_INVALID_FORMAT_E;
+
+        size_t szLineStart = 0;
+        size_t szLineLen = 0;
+        if (!PinCfgCsv_bFindLine(pcOut, szLen, &sKey, &szLineStart, &szLineLen))
+        {
+            if (bDelete)
+                return PINCFG_ERROR_E;
+
+            // appended, an unterminated last line gets its separator first
+            size_t szSeparator = (szLen > 0 && pcOut[szLen - 1] != PINCFG_LINE_SEPARATOR_D) ? 1 : 0;
+            if (szLen + szSeparator + sEdit.szLen + 2 > szOutMax)
+                return PINCFG_MAXLEN_ERROR_E;
+
+            if (szSeparator > 0)
+                pcOut[szLen++] = PINCFG_LINE_SEPARATOR_D;
+            memcpy(&pcOut[szLen], sEdit.pcStrStart, sEdit.szLen);
+            szLen += sEdit.szLen;
+            pcOut[szLen++] = PINCFG_LINE_SEPARATOR_D;
+            pcOut[szLen] = '\0';
+            continue;
+        }
+
+        // the line goes with its separator, the new one gets its own
+        size_t szOld = szLineLen + ((szLineStart + szLineLen < szLen) ? 1 : 0);
+        size_t szNew = bDelete ? 0 : sEdit.szLen + 1;
+        if (szLen - szOld + szNew + 1 > szOutMax)
+            return PINCFG_MAXLEN_ERROR_E;
+
+        memmove(&pcOut[szLineStart + szNew], &pcOut[szLineStart + szOld], szLen - szLineStart - szOld + 1);
+        if (!bDelete)
+        {
+            memcpy(&pcOut[szLineStart], sEdit.pcStrStart, sEdit.szLen);
+            pcOut[szLineStart + sEdit.szLen] = PINCFG_LINE_SEPARATOR_D;
+        }
+        szLen = szLen - szOld + szNew;
+    }
+
+    return PINCFG_OK_E;
+}
+
 PINCFG_RESULT_T PinCfgCsv_eInitMemoryAndTypes(uint8_t *pu8Memory, size_t szMemorySize)
 {
     if (Memory_eInit(pu8Memory, szMemorySize) != MEMORY_OK_E)
@@ -302,6 +541,29 @@ PINCFG_RESULT_T PinCfgCsv_eInitMemoryAndTypes(uint8_t *pu8Memory, size_t szMemor
         return PINCFG_MEMORYINIT_ERROR_E;
     }
 
+    vSendQueueInit(&psGlobals->sSendQueue);
+    StateJournal_vInit();
+    LoopStats_vInit();
+    Profiler_vInit();
+    Trace_vInit();
+
+    // with MY_CONTROLLER_HA initial states are sent even if presentation is not requested
+#ifdef MY_CONTROLLER_HA
+    psGlobals->u8PresentationState = PINCFG_PRESENTATION_INITIAL_STATES_E;
+#else
+    psGlobals->u8PresentationState = PINCFG_PRESENTATION_IDLE_E;
+#endif
+    psGlobals->u16PresentationIdx = 0;
+    psGlobals->u32PresentationSlotMs = 0;
+    psGlobals->bReloadPending = false;
+
+    PinCfgCsv_vInitTypes();
+
+    return PINCFG_OK_E;
+}
+
+static void PinCfgCsv_vInitTypes(void)
+{
     // V tabs init
     // extcfgreceiver
     Cli_vInitType(&(psGlobals->sCliPrVTab));
@@ -309,8 +571,6 @@ PINCFG_RESULT_T PinCfgCsv_eInitMemoryAndTypes(uint8_t *pu8Memory, size_t szMemor
     Switch_vInitType(&(psGlobals->sSwitchPrVTab));
     // inpin
     InPin_vInitType(&(psGlobals->sInPinPrVTab));
-
-    return PINCFG_OK_E;
 }
 
 PINCFG_RESULT_T PinCfgCsv_eInit(uint8_t *pu8Memory, size_t szMemorySize, const char *pcDefaultCfg)
@@ -329,8 +589,8 @@ PINCFG_RESULT_T PinCfgCsv_eInit(uint8_t *pu8Memory, size_t szMemorySize, const c
 
     PINCFG_PARSE_PARAMS_T sParseParams = {
         .pcConfig = NULL,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = NULL,
         .pcOutString = NULL,
         .u16OutStrMaxLen = 0,
@@ -369,28 +629,42 @@ PINCFG_RESULT_T PinCfgCsv_eInit(uint8_t *pu8Memory, size_t szMemorySize, const c
         ePincfgResult = PinCfgCsv_eParse(&sParseParams);
     }
 
-    // Only convert linked lists to arrays if they were actually created
-    // Empty config doesn't create linked lists, so skip conversion
-    // Check if the lists are still NULL (indicating no items were added)
-    if (psGlobals->ppsLoopables != NULL || psGlobals->ppsPresentables != NULL)
+    // last known switch states, before the first loop drives the outputs
+    if (psGlobals->u16PresentablesCount > 0)
+        StateJournal_vRestore();
+
+    if (ePincfgResult == PINCFG_OUTOFMEMORY_ERROR_E && psGlobals->u16PresentablesCount > 0)
     {
-        // move loopables, presentables, and measurements from linked list to array
-        LINKEDLIST_RESULT_T eLinkedListResult = LinkedList_eLinkedListToArray(
-            (LINKEDLIST_ITEM_T **)&(psGlobals->ppsLoopables), &(psGlobals->u8LoopablesCount));
-        if (eLinkedListResult != LINKEDLIST_OK_E)
-            return PINCFG_OUTOFMEMORY_ERROR_E;
+        CLI_T *psCli = (CLI_T *)psGlobals->ppsPresentables[0];
+        Cli_vSetState(psCli, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+    }
 
-        eLinkedListResult = LinkedList_eLinkedListToArray(
-            (LINKEDLIST_ITEM_T **)&(psGlobals->ppsPresentables), &(psGlobals->u8PresentablesCount));
-        if (eLinkedListResult != LINKEDLIST_OK_E)
-            return PINCFG_OUTOFMEMORY_ERROR_E;
+    Memory_vTempFree();
+
+    return ePincfgResult;
+}
 
-        // Note: Measurements are NOT converted to array
-        // They remain in linked list during parsing only
-        // Sensors store direct pointers, so no array needed at runtime
+PINCFG_RESULT_T PinCfgCsv_eInitStatic(uint8_t *pu8Memory, size_t szMemorySize, const PINCFG_STATIC_CFG_T *psCfg)
+{
+#ifndef USE_MALLOC
+    if (pu8Memory == NULL)
+    {
+        return PINCFG_NULLPTR_ERROR_E;
     }
+#endif // USE_MALLOC
+    if (psCfg == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    PINCFG_RESULT_T eResult = PinCfgCsv_eInitMemoryAndTypes(pu8Memory, szMemorySize);
+    if (eResult != PINCFG_OK_E)
+        return eResult;
 
-    if (ePincfgResult == PINCFG_OUTOFMEMORY_ERROR_E && psGlobals->u8PresentablesCount > 0)
+    eResult = PinCfgCsv_eCreateStatic(psCfg);
+
+    if (psGlobals->u16PresentablesCount > 0)
+        StateJournal_vRestore();
+
+    if (eResult == PINCFG_OUTOFMEMORY_ERROR_E && psGlobals->u16PresentablesCount > 0)
     {
         CLI_T *psCli = (CLI_T *)psGlobals->ppsPresentables[0];
         Cli_vSetState(psCli, CLI_OUT_OF_MEM_ERR_E, NULL, true);
@@ -398,7 +672,223 @@ PINCFG_RESULT_T PinCfgCsv_eInit(uint8_t *pu8Memory, size_t szMemorySize, const c
 
     Memory_vTempFree();
 
-    return ePincfgResult;
+    return eResult;
+}
+
+PINCFG_RESULT_T PinCfgCsv_eReload(void)
+{
+    psGlobals->bReloadPending = false;
+
+    // the upload is done, its buffers would only take the room of the new generation
+    uint16_t u16OldCount = psGlobals->u16PresentablesCount;
+    if (u16OldCount > 0)
+        Cli_vReleaseBuffers((CLI_T *)psGlobals->ppsPresentables[0]);
+
+    // names, ids and states of the running config
+    size_t szSnapshot = u16OldCount * sizeof(PINCFG_RELOAD_ITEM_T);
+    for (uint16_t i = 0; i < u16OldCount; i++)
+        szSnapshot += strlen(Presentable_pcGetName(psGlobals->ppsPresentables[i])) + 1;
+
+    PINCFG_RELOAD_ITEM_T *pasOld = (PINCFG_RELOAD_ITEM_T *)Memory_vpTempAlloc(szSnapshot + 1);
+    if (pasOld == NULL)
+        return PINCFG_OUTOFMEMORY_ERROR_E;
+
+    char *pcNames = (char *)&pasOld[u16OldCount];
+    for (uint16_t i = 0; i < u16OldCount; i++)
+    {
+        PRESENTABLE_T *psOld = psGlobals->ppsPresentables[i];
+        size_t szNameLen = strlen(Presentable_pcGetName(psOld)) + 1;
+
+        memcpy(pcNames, Presentable_pcGetName(psOld), szNameLen);
+        pasOld[i].pcName = pcNames;
+        pasOld[i].u16Id = psOld->u16Id;
+        pasOld[i].u8SType = (uint8_t)psOld->psVtab->eSType;
+        pasOld[i].u8VType = (uint8_t)psOld->psVtab->eVType;
+        pasOld[i].u8Flags = psOld->u8Flags;
+        pasOld[i].u8State = Presentable_u8GetState(psOld);
+        pcNames += szNameLen;
+    }
+
+    uint16_t u16CfgSize = 0;
+    char *pcCfg = NULL;
+    if (PersistentCfg_eGetConfigSize(&u16CfgSize) == PERCFG_OK_E && u16CfgSize > 1)
+        pcCfg = (char *)Memory_vpTempAlloc(u16CfgSize + 1);
+    if (pcCfg == NULL || PersistentCfg_eLoadConfig(pcCfg) != PERCFG_OK_E)
+    {
+        // the running config stays untouched
+        Memory_vTempFreePt(pcCfg);
+        Memory_vTempFreePt(pasOld);
+        return (pcCfg == NULL && u16CfgSize > 1) ? PINCFG_OUTOFMEMORY_ERROR_E : PINCFG_ERROR_E;
+    }
+
+    // there is no way back once the old generation is dropped, the new one has to fit next to the temp blocks
+    size_t szMemoryRequired = 0;
+    PINCFG_RESULT_T eResult = PinCfgCsv_eValidate(pcCfg, &szMemoryRequired, NULL, 0);
+    if (eResult == PINCFG_OK_E || eResult == PINCFG_WARNINGS_E)
+    {
+        szMemoryRequired -= Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+        if (szMemoryRequired > Memory_szGetFreeAfterReset())
+            eResult = PINCFG_OUTOFMEMORY_ERROR_E;
+    }
+    if (eResult != PINCFG_OK_E && eResult != PINCFG_WARNINGS_E)
+    {
+        Memory_vTempFreePt(pcCfg);
+        Memory_vTempFreePt(pasOld);
+        return eResult;
+    }
+
+    // the new generation is built over the old one, the snapshot and the config are temporary
+    Memory_eResetPermanent();
+    PinCfgCsv_vInitTypes();
+
+    PINCFG_PARSE_PARAMS_T sParseParams = {
+        .pcConfig = pcCfg,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
+        .pszMemoryRequired = NULL,
+        .pcOutString = NULL,
+        .u16OutStrMaxLen = 0,
+        .bValidate = false};
+    eResult = PinCfgCsv_eParse(&sParseParams);
+    if (eResult != PINCFG_OK_E && eResult != PINCFG_WARNINGS_E)
+    {
+        // the old config is gone and the new one is not complete
+        Cli_vRestartNode();
+        Memory_vTempFreePt(pcCfg);
+        Memory_vTempFreePt(pasOld);
+        return eResult;
+    }
+
+    PinCfgCsv_vCarryOver(pasOld, u16OldCount);
+
+    Memory_vTempFreePt(pcCfg);
+    Memory_vTempFreePt(pasOld);
+    // buffers of the replaced CLI are not referenced anymore
+    Memory_vTempFree();
+
+    return eResult;
+}
+
+void PinCfgCsv_vRequestReload(void)
+{
+    psGlobals->bReloadPending = true;
+}
+
+static void PinCfgCsv_vReloadFromLoop(void)
+{
+    PINCFG_RESULT_T eResult = PinCfgCsv_eReload();
+    if (eResult == PINCFG_OK_E || eResult == PINCFG_WARNINGS_E || psGlobals->u16PresentablesCount == 0)
+        return;
+
+    CLI_T *psCli = (CLI_T *)psGlobals->ppsPresentables[0];
+    if (eResult == PINCFG_OUTOFMEMORY_ERROR_E)
+        Cli_vSetState(psCli, CLI_OUT_OF_MEM_ERR_E, NULL, true);
+    else
+        Cli_vSetState(psCli, CLI_CUSTOM_E, "Reload failed, RESET to apply.", true);
+}
+
+static const PINCFG_RELOAD_ITEM_T *PinCfgCsv_psFindReloadItem(
+    const PINCFG_RELOAD_ITEM_T *pasOld,
+    uint16_t u16OldCount,
+    uint16_t u16Idx,
+    const char *pcName)
+{
+    // unchanged configs keep their order, the same position is tried first
+    if (u16Idx < u16OldCount && strcmp(pasOld[u16Idx].pcName, pcName) == 0)
+        return &pasOld[u16Idx];
+
+    for (uint16_t i = 0; i < u16OldCount; i++)
+    {
+        if (strcmp(pasOld[i].pcName, pcName) == 0)
+            return &pasOld[i];
+    }
+
+    return NULL;
+}
+
+static void PinCfgCsv_vCarryOver(const PINCFG_RELOAD_ITEM_T *pasOld, uint16_t u16OldCount)
+{
+    bool bPresent = false;
+
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+    {
+        PRESENTABLE_T *psNew = psGlobals->ppsPresentables[i];
+        const PINCFG_RELOAD_ITEM_T *psOld =
+            PinCfgCsv_psFindReloadItem(pasOld, u16OldCount, i, Presentable_pcGetName(psNew));
+
+        // journaled again under the new config
+        if (psOld != NULL && (psOld->u8Flags & psNew->u8Flags & PRESENTABLE_FLAG_PERSIST))
+            Presentable_vSetState(psNew, (int32_t)psOld->u8State, false);
+
+        // the controller knows a child by its id, anything else changed is presented again
+        if (psOld != NULL && psOld->u16Id == psNew->u16Id && psOld->u8SType == (uint8_t)psNew->psVtab->eSType &&
+            psOld->u8VType == (uint8_t)psNew->psVtab->eVType)
+            psNew->u8Flags |= psOld->u8Flags & (PRESENTABLE_FLAG_STATE_PRESENTED | PRESENTABLE_FLAG_PRESENT_PENDING);
+        else
+            psNew->u8Flags |= PRESENTABLE_FLAG_PRESENT_PENDING;
+
+        if (psNew->u8Flags & PRESENTABLE_FLAG_PRESENT_PENDING)
+            bPresent = true;
+    }
+
+    psGlobals->u16PresentationIdx = 0;
+    if (bPresent)
+        psGlobals->u8PresentationState = PINCFG_PRESENTATION_PRESENTING_E;
+#ifdef MY_CONTROLLER_HA
+    else
+        psGlobals->u8PresentationState = PINCFG_PRESENTATION_INITIAL_STATES_E;
+#endif
+}
+
+PINCFG_RESULT_T PinCfgCsv_eInitCtx(
+    PINCFG_CTX_T **ppsCtx,
+    uint8_t *pu8Memory,
+    size_t szMemorySize,
+    const char *pcDefaultCfg)
+{
+    if (ppsCtx == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    // malloc mode reuses the active instance and allocates one only when there is none
+    psGlobals = *ppsCtx;
+    PINCFG_RESULT_T eResult = PinCfgCsv_eInit(pu8Memory, szMemorySize, pcDefaultCfg);
+    *ppsCtx = psGlobals;
+
+    return eResult;
+}
+
+void PinCfgCsv_vLoopCtx(PINCFG_CTX_T *psCtx, uint32_t u32ms)
+{
+    psGlobals = psCtx;
+    PinCfgCsv_vLoop(u32ms);
+}
+
+void PinCfgCsv_vPresentationCtx(PINCFG_CTX_T *psCtx)
+{
+    psGlobals = psCtx;
+    PinCfgCsv_vPresentation();
+}
+
+bool PinCfgCsv_bPresentationDoneCtx(PINCFG_CTX_T *psCtx)
+{
+    psGlobals = psCtx;
+    return PinCfgCsv_bPresentationDone();
+}
+
+void PinCfgCsv_vReceiveMessageCtx(PINCFG_CTX_T *psCtx, const MyMessage *message)
+{
+    psGlobals = psCtx;
+    PinCfgCsv_vReceiveMessage(message);
+}
+
+PINCFG_CTX_T *PinCfgCsv_psGetCtx(void)
+{
+    return psGlobals;
+}
+
+void PinCfgCsv_vSetCtx(PINCFG_CTX_T *psCtx)
+{
+    psGlobals = psCtx;
 }
 
 PINCFG_RESULT_T PinCfgCsv_eParse(PINCFG_PARSE_PARAMS_T *psParams)
@@ -408,158 +898,462 @@ PINCFG_RESULT_T PinCfgCsv_eParse(PINCFG_PARSE_PARAMS_T *psParams)
         .pcOutStringLast = 0,
         .u16LinesProcessed = 0,
         .u8LineItemsLen = 0,
-        .u8PresentablesCount = 0,
+        .u16PresentablesCount = 0,
+        .u16PresentablesRequired = 0,
+        .u16ChildIds = 0,
+        .u16LoopablesRequired = 0,
+        .u16SwitchesRequired = 0,
+        .u16InPinsRequired = 0,
+        .szNumberOfWarnings = 0,
+        .psMeasurementsListHead = NULL, // Initialize measurement list
+        .szNameChunkLeft = 0};
+
+    // items are created - count them first so the final arrays are allocated once, ahead of the components
+    if (!psParams->bValidate)
+    {
+        PINCFG_RESULT_T eResult = PinCfgCsv_eAllocItemArrays(psParams);
+        if (eResult != PINCFG_OK_E)
+        {
+            sPrms.pcOutStringLast += LOG_SIMPLE_ERROR(
+                psParams->pcOutString, sPrms.pcOutStringLast, psParams->u16OutStrMaxLen, ERR_OOM);
+            return eResult;
+        }
+    }
+
+    return PinCfgCsv_eParseConfig(&sPrms);
+}
+
+// private
+static PINCFG_RESULT_T PinCfgCsv_eAllocItemArrays(PINCFG_PARSE_PARAMS_T *psParams)
+{
+    size_t szMemoryRequired = 0;
+    PINCFG_PARSE_PARAMS_T sCountParams = {
+        .pcConfig = psParams->pcConfig,
+        .eAddToLoopables = psParams->eAddToLoopables,
+        .eAddToPresentables = psParams->eAddToPresentables,
+        .pszMemoryRequired = &szMemoryRequired,
+        .pcOutString = NULL,
+        .u16OutStrMaxLen = 0,
+        .bValidate = true};
+    PINCFG_PARSE_SUBFN_PARAMS_T sPrms = {
+        .psParsePrms = &sCountParams,
+        .pcOutStringLast = 0,
+        .u16LinesProcessed = 0,
+        .u8LineItemsLen = 0,
+        .u16PresentablesCount = 0,
+        .u16PresentablesRequired = 0,
+        .u16ChildIds = 0,
+        .u16LoopablesRequired = 0,
+        .u16SwitchesRequired = 0,
+        .u16InPinsRequired = 0,
         .szNumberOfWarnings = 0,
-        .psMeasurementsListHead = NULL}; // Initialize measurement list
+        .psMeasurementsListHead = NULL,
+        .szNameChunkLeft = 0};
+
+    // errors are reported by the real pass, the CLI is counted even for an invalid config
+    (void)PinCfgCsv_eParseConfig(&sPrms);
+    // the requirement is known even when the arrays do not fit
+    if (psParams->pszMemoryRequired != NULL)
+        *(psParams->pszMemoryRequired) = szMemoryRequired;
+
+    return PinCfgCsv_eAllocArrays(
+        sPrms.u16LoopablesRequired, sPrms.u16PresentablesRequired, sPrms.u16SwitchesRequired, sPrms.u16InPinsRequired);
+}
+
+static PINCFG_RESULT_T PinCfgCsv_eAllocArrays(
+    uint16_t u16Loopables,
+    uint16_t u16Presentables,
+    uint16_t u16Switches,
+    uint16_t u16InPins)
+{
+    psGlobals->ppsLoopables = NULL;
+    psGlobals->ppsPresentables = NULL;
+    psGlobals->u16LoopablesCount = 0;
+    psGlobals->u16PresentablesCount = 0;
+    psGlobals->u16LoopablesMax = 0;
+    psGlobals->u16PresentablesMax = 0;
+    psGlobals->pasSwitches = NULL;
+    psGlobals->pasInPins = NULL;
+    psGlobals->u16SwitchesCount = 0;
+    psGlobals->u16SwitchesMax = 0;
+    psGlobals->u16InPinsCount = 0;
+    psGlobals->u16InPinsMax = 0;
+#if PINCFG_PROFILER_D
+    psGlobals->pasProfile = NULL;
+#endif
+
+    Memory_vSetTag(MEMORY_TAG_ARRAYS_E);
+    if (u16Loopables > 0)
+    {
+        psGlobals->ppsLoopables = (LOOPABLE_T **)Memory_vpAlloc(sizeof(LOOPABLE_T *) * u16Loopables);
+        if (psGlobals->ppsLoopables == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        psGlobals->u16LoopablesMax = u16Loopables;
+    }
 
+    if (u16Presentables > 0)
+    {
+        psGlobals->ppsPresentables = (PRESENTABLE_T **)Memory_vpAlloc(sizeof(PRESENTABLE_T *) * u16Presentables);
+        if (psGlobals->ppsPresentables == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        psGlobals->u16PresentablesMax = u16Presentables;
+    }
+
+    Memory_vSetTag(MEMORY_TAG_SWITCH_E);
+    if (u16Switches > 0)
+    {
+        psGlobals->pasSwitches = (SWITCH_T *)Memory_vpAlloc(sizeof(SWITCH_T) * u16Switches);
+        if (psGlobals->pasSwitches == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        psGlobals->u16SwitchesMax = u16Switches;
+    }
+
+    Memory_vSetTag(MEMORY_TAG_INPUT_E);
+    if (u16InPins > 0)
+    {
+        psGlobals->pasInPins = (INPIN_T *)Memory_vpAlloc(sizeof(INPIN_T) * u16InPins);
+        if (psGlobals->pasInPins == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        psGlobals->u16InPinsMax = u16InPins;
+    }
+
+#if PINCFG_PROFILER_D
+    Memory_vSetTag(MEMORY_TAG_ARRAYS_E);
+    size_t szEntries = Profiler_szGetEntriesCount(u16Loopables, u16InPins, u16Switches);
+    if (szEntries > 0)
+    {
+        psGlobals->pasProfile = (PROFILER_ENTRY_T *)Memory_vpAlloc(sizeof(PROFILER_ENTRY_T) * szEntries);
+        if (psGlobals->pasProfile == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        memset(psGlobals->pasProfile, 0, sizeof(PROFILER_ENTRY_T) * szEntries);
+    }
+#endif
+    Memory_vSetTag(MEMORY_TAG_OTHER_E);
+
+    return PINCFG_OK_E;
+}
+
+// places a component of a static config at its id, the ids are checked as the tables are not
+static bool PinCfgCsv_bPlaceStatic(PRESENTABLE_T *psPresentable)
+{
+    uint16_t u16Id = psPresentable->u16Id;
+    if (u16Id == 0 || u16Id >= psGlobals->u16PresentablesMax || psGlobals->ppsPresentables[u16Id] != NULL)
+        return false;
+
+    psGlobals->ppsPresentables[u16Id] = psPresentable;
+    return true;
+}
+
+// on AVR the static name is in PROGMEM, components need it in SRAM
+static const char *PinCfgCsv_pcStaticName(const char *pcName)
+{
+#if defined(ARDUINO_ARCH_AVR)
+    char *pcResult = Memory_pcNameAlloc(strlen_P(pcName));
+    if (pcResult != NULL)
+        strcpy_P(pcResult, pcName);
+
+    return pcResult;
+#else
+    return pcName;
+#endif // ARDUINO_ARCH_AVR
+}
+
+static PINCFG_RESULT_T PinCfgCsv_eCreateStatic(const PINCFG_STATIC_CFG_T *psCfgSrc)
+{
+    PINCFG_STATIC_CFG_T sCfg;
+    PINCFG_STATIC_READ(&sCfg, psCfgSrc, sizeof(sCfg));
+    const PINCFG_STATIC_CFG_T *psCfg = &sCfg;
+
+    // the CLI is the only loopable, switches and inputs are looped from their arrays
+    uint32_t u32Presentables = 1UL + psCfg->u16SwitchesCount + psCfg->u16InPinsCount;
+    if (u32Presentables > PINCFG_CHILD_IDS_MAX_D)
+        return PINCFG_INVALID_FORMAT_E;
+    uint16_t u16Presentables = (uint16_t)u32Presentables;
+    PINCFG_RESULT_T eResult =
+        PinCfgCsv_eAllocArrays(1U, u16Presentables, psCfg->u16SwitchesCount, psCfg->u16InPinsCount);
+    if (eResult != PINCFG_OK_E)
+        return eResult;
+    memset(psGlobals->ppsPresentables, 0, sizeof(PRESENTABLE_T *) * u16Presentables);
+
+    if (psCfg->u32InPinDebounceMs != PINCFG_STATIC_DEFAULT)
+        InPin_SetDebounceMs(psCfg->u32InPinDebounceMs);
+    if (psCfg->u32InPinMulticlickMaxDelayMs != PINCFG_STATIC_DEFAULT)
+        InPin_SetMulticlickMaxDelayMs(psCfg->u32InPinMulticlickMaxDelayMs);
+    if (psCfg->u32SwitchImpulseDurationMs != PINCFG_STATIC_DEFAULT)
+        Switch_SetImpulseDurationMs(psCfg->u32SwitchImpulseDurationMs);
+    if (psCfg->u32SwitchFbDelayMs != PINCFG_STATIC_DEFAULT)
+        Switch_SetFbDelayMs(psCfg->u32SwitchFbDelayMs);
+
+    CLI_T *psCli = (CLI_T *)Memory_vpAlloc(sizeof(CLI_T));
+    if (psCli == NULL)
+        return PINCFG_OUTOFMEMORY_ERROR_E;
+    if (Cli_eInit(psCli, 0U) != CLI_OK_E)
+        return PINCFG_ERROR_E;
+    PinCfgCsv_eAddToPresentables((PRESENTABLE_T *)psCli);
+    PinCfgCsv_eAddToLoopables(&psCli->sLoopable);
+
+    // switches and inputs of the parsed config interleave in line order, they are placed by their ids
+    for (uint16_t i = 0; i < psCfg->u16SwitchesCount; i++)
+    {
+        PINCFG_STATIC_SWITCH_T sDesc;
+        PINCFG_STATIC_READ(&sDesc, &psCfg->pasSwitches[i], sizeof(sDesc));
+        const PINCFG_STATIC_SWITCH_T *psDesc = &sDesc;
+        const char *pcName = PinCfgCsv_pcStaticName(psDesc->pcName);
+        if (pcName == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        SWITCH_T *psSwitchHnd = &psGlobals->pasSwitches[i];
+        if (Switch_eInitReuseName(
+                psSwitchHnd,
+                pcName,
+                psDesc->u16Id,
+                (SWITCH_MODE_T)psDesc->u8Mode,
+                psDesc->u8Pin,
+                psDesc->u8FbPin,
+                psDesc->u32TimedPeriodMs) != SWITCH_OK_E ||
+            !PinCfgCsv_bPlaceStatic((PRESENTABLE_T *)psSwitchHnd))
+            return PINCFG_INVALID_FORMAT_E;
+        psGlobals->u16SwitchesCount++;
+    }
+
+    for (uint16_t i = 0; i < psCfg->u16InPinsCount; i++)
+    {
+        PINCFG_STATIC_INPIN_T sDesc;
+        PINCFG_STATIC_READ(&sDesc, &psCfg->pasInPins[i], sizeof(sDesc));
+        const PINCFG_STATIC_INPIN_T *psDesc = &sDesc;
+        const char *pcName = PinCfgCsv_pcStaticName(psDesc->pcName);
+        if (pcName == NULL)
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        INPIN_T *psInPinHnd = &psGlobals->pasInPins[i];
+        if (InPin_eInitReuseName(psInPinHnd, pcName, psDesc->u16Id, psDesc->u8Pin) != INPIN_OK_E ||
+            !PinCfgCsv_bPlaceStatic((PRESENTABLE_T *)psInPinHnd))
+            return PINCFG_INVALID_FORMAT_E;
+        psGlobals->u16InPinsCount++;
+    }
+    psGlobals->u16PresentablesCount = u16Presentables;
+
+    if (psCfg->u16TriggersCount == 0)
+        return PINCFG_OK_E;
+    if (psCfg->u16ActionsCount == 0)
+        return PINCFG_INVALID_FORMAT_E;
+
+    // switch actions of all triggers in one array, each trigger points to its slice
+    Memory_vSetTag(MEMORY_TAG_TRIGGER_E);
+    TRIGGER_SWITCHACTION_T *pasSwActs =
+        (TRIGGER_SWITCHACTION_T *)Memory_vpAlloc(sizeof(TRIGGER_SWITCHACTION_T) * psCfg->u16ActionsCount);
+    TRIGGER_T *pasTriggers = (TRIGGER_T *)Memory_vpAlloc(sizeof(TRIGGER_T) * psCfg->u16TriggersCount);
+    Memory_vSetTag(MEMORY_TAG_OTHER_E);
+    if (pasSwActs == NULL || pasTriggers == NULL)
+        return PINCFG_OUTOFMEMORY_ERROR_E;
+
+    for (uint16_t i = 0; i < psCfg->u16ActionsCount; i++)
+    {
+        PINCFG_STATIC_SWITCHACTION_T sDesc;
+        PINCFG_STATIC_READ(&sDesc, &psCfg->pasActions[i], sizeof(sDesc));
+        const PINCFG_STATIC_SWITCHACTION_T *psDesc = &sDesc;
+        if (psDesc->u16Switch >= psGlobals->u16SwitchesCount || psDesc->u8Action > (uint8_t)TRIGGER_A_FORWARD_E)
+            return PINCFG_INVALID_FORMAT_E;
+
+        pasSwActs[i].psSwitchHnd = &psGlobals->pasSwitches[psDesc->u16Switch];
+        pasSwActs[i].eAction = (TRIGGER_ACTION_T)psDesc->u8Action;
+    }
+
+    for (uint16_t i = 0; i < psCfg->u16TriggersCount; i++)
+    {
+        PINCFG_STATIC_TRIGGER_T sDesc;
+        PINCFG_STATIC_READ(&sDesc, &psCfg->pasTriggers[i], sizeof(sDesc));
+        const PINCFG_STATIC_TRIGGER_T *psDesc = &sDesc;
+        if (psDesc->u16InPin >= psGlobals->u16InPinsCount || psDesc->u8EventType > (uint8_t)TRIGGER_ALL_E ||
+            psDesc->u8ActionsCount == 0U ||
+            (uint32_t)psDesc->u16FirstAction + psDesc->u8ActionsCount > psCfg->u16ActionsCount)
+            return PINCFG_INVALID_FORMAT_E;
+
+        TRIGGER_T *psTriggerHnd = &pasTriggers[i];
+        if ((Trigger_eInit(
+                 psTriggerHnd,
+                 &pasSwActs[psDesc->u16FirstAction],
+                 psDesc->u8ActionsCount,
+                 (TRIGGER_EVENTTYPE_T)psDesc->u8EventType,
+                 psDesc->i32EventData) != TRIGGER_OK_E) ||
+            (EventPublisher_eAddSubscriber(
+                 (IEVENTPUBLISHER_T *)&psGlobals->pasInPins[psDesc->u16InPin], (IEVENTSUBSCRIBER_T *)psTriggerHnd) !=
+             EVENTSUBSCRIBER_OK_E))
+            return PINCFG_INVALID_FORMAT_E;
+        psTriggerHnd->u16Line = psDesc->u16Line;
+    }
+
+    return PINCFG_OK_E;
+}
+
+static PINCFG_RESULT_T PinCfgCsv_eParseConfig(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms)
+{
     uint16_t u16LinesLen;
     PINCFG_RESULT_T eResult = PINCFG_ERROR_E;
 
-    if (sPrms.psParsePrms->pszMemoryRequired != NULL)
+    if (psPrms->psParsePrms->pszMemoryRequired != NULL)
     {
         // Initialize with base memory (GLOBALS_T)
-        // CLI and linked list items will be added by CreateCli and other creation functions
-        *(sPrms.psParsePrms->pszMemoryRequired) = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+        // CLI, components and their array slots will be added by CreateCli and other creation functions
+        *(psPrms->psParsePrms->pszMemoryRequired) = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
     }
 
-    if (sPrms.psParsePrms->pcOutString != NULL && sPrms.psParsePrms->u16OutStrMaxLen > 0)
-        sPrms.psParsePrms->pcOutString[0] = '\0';
+    if (psPrms->psParsePrms->pcOutString != NULL && psPrms->psParsePrms->u16OutStrMaxLen > 0)
+        psPrms->psParsePrms->pcOutString[0] = '\0';
 
     // Try to create CLI first - this allows OOM detection even with invalid config
     // This is important for memory requirement validation in test scenarios
-    eResult = PinCfgCsv_CreateCli(&sPrms);
+    eResult = PinCfgCsv_CreateCli(psPrms);
     if (eResult != PINCFG_OK_E)
         return eResult;
 
     // Now check for NULL config after CLI creation attempt
-    if (psParams->pcConfig == NULL)
+    if (psPrms->psParsePrms->pcConfig == NULL)
     {
-        sPrms.pcOutStringLast += LOG_SIMPLE_ERROR(
-            sPrms.psParsePrms->pcOutString, sPrms.pcOutStringLast, sPrms.psParsePrms->u16OutStrMaxLen, ERR_NULL_CONFIG);
+        psPrms->pcOutStringLast += LOG_SIMPLE_ERROR(
+            psPrms->psParsePrms->pcOutString,
+            psPrms->pcOutStringLast,
+            psPrms->psParsePrms->u16OutStrMaxLen,
+            ERR_NULL_CONFIG);
         return PINCFG_NULLPTR_ERROR_E;
     }
 
     // Check for empty config after CLI creation
-    PinCfgStr_vInitStrPoint(&(sPrms.sTempStrPt), psParams->pcConfig, strlen(psParams->pcConfig));
-    u16LinesLen = (uint8_t)PinCfgStr_szGetSplitCount(&(sPrms.sTempStrPt), PINCFG_LINE_SEPARATOR_D);
-    if (u16LinesLen == 0 || (u16LinesLen == 1 && sPrms.sTempStrPt.szLen == 0))
+    PinCfgStr_vInitStrPoint(
+        &(psPrms->sTempStrPt), psPrms->psParsePrms->pcConfig, strlen(psPrms->psParsePrms->pcConfig));
+    u16LinesLen = (uint16_t)PinCfgStr_szGetSplitCount(&(psPrms->sTempStrPt), PINCFG_LINE_SEPARATOR_D);
+    if (u16LinesLen == 0 || (u16LinesLen == 1 && psPrms->sTempStrPt.szLen == 0))
     {
         // Empty config is an error - CLI already created but that's OK
-        sPrms.pcOutStringLast += LOG_SIMPLE_ERROR(
-            sPrms.psParsePrms->pcOutString,
-            sPrms.pcOutStringLast,
-            sPrms.psParsePrms->u16OutStrMaxLen,
+        psPrms->pcOutStringLast += LOG_SIMPLE_ERROR(
+            psPrms->psParsePrms->pcOutString,
+            psPrms->pcOutStringLast,
+            psPrms->psParsePrms->u16OutStrMaxLen,
             ERR_EMPTY_CONFIG);
         return PINCFG_ERROR_E;
     }
 
-    for (sPrms.u16LinesProcessed = 0; sPrms.u16LinesProcessed < u16LinesLen; sPrms.u16LinesProcessed++)
+    for (psPrms->u16LinesProcessed = 0; psPrms->u16LinesProcessed < u16LinesLen; psPrms->u16LinesProcessed++)
     {
-        PinCfgStr_vInitStrPoint(&(sPrms.sLine), psParams->pcConfig, strlen(psParams->pcConfig));
-        PinCfgStr_vGetSplitElemByIndex(&(sPrms.sLine), PINCFG_LINE_SEPARATOR_D, sPrms.u16LinesProcessed);
-        if (sPrms.sLine.pcStrStart[0] == '#') // comment continue
+        PinCfgStr_vInitStrPoint(&(psPrms->sLine), psPrms->psParsePrms->pcConfig, strlen(psPrms->psParsePrms->pcConfig));
+        PinCfgStr_vGetSplitElemByIndex(&(psPrms->sLine), PINCFG_LINE_SEPARATOR_D, psPrms->u16LinesProcessed);
+        if (psPrms->sLine.pcStrStart[0] == '#') // comment continue
             continue;
 
-        sPrms.u8LineItemsLen = (uint8_t)PinCfgStr_szGetSplitCount(&(sPrms.sLine), PINCFG_VALUE_SEPARATOR_D);
-        if (sPrms.u8LineItemsLen < 2)
+        psPrms->u8LineItemsLen = (uint8_t)PinCfgStr_szGetSplitCount(&(psPrms->sLine), PINCFG_VALUE_SEPARATOR_D);
+        if (psPrms->u8LineItemsLen < 2)
         {
-            sPrms.pcOutStringLast += LOG_WARNING(&sPrms, "", ERR_UNDEFINED_FORMAT);
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, "", ERR_UNDEFINED_FORMAT);
             continue;
         }
 
-        sPrms.sTempStrPt = sPrms.sLine;
-        PinCfgStr_vGetSplitElemByIndex(&(sPrms.sTempStrPt), PINCFG_VALUE_SEPARATOR_D, 0);
+        psPrms->sTempStrPt = psPrms->sLine;
+        PinCfgStr_vGetSplitElemByIndex(&(psPrms->sTempStrPt), PINCFG_VALUE_SEPARATOR_D, 0);
 
         // Phase 2: Check 2-character prefixes FIRST before 1-character ones
         // Measurement Source (MS)
-        if (sPrms.sTempStrPt.szLen == 2 && sPrms.sTempStrPt.pcStrStart[0] == 'M' &&
-            sPrms.sTempStrPt.pcStrStart[1] == 'S')
+        if (psPrms->sTempStrPt.szLen == 2 && psPrms->sTempStrPt.pcStrStart[0] == 'M' &&
+            psPrms->sTempStrPt.pcStrStart[1] == 'S')
         {
-            eResult = PinCfgCsv_ParseMeasurementSource(&sPrms);
+            eResult = PinCfgCsv_ParseMeasurementSource(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         // Phase 2: Sensor Reporter (SR)
         else if (
-            sPrms.sTempStrPt.szLen == 2 && sPrms.sTempStrPt.pcStrStart[0] == 'S' &&
-            sPrms.sTempStrPt.pcStrStart[1] == 'R')
+            psPrms->sTempStrPt.szLen == 2 && psPrms->sTempStrPt.pcStrStart[0] == 'S' &&
+            psPrms->sTempStrPt.pcStrStart[1] == 'R')
         {
-            eResult = PinCfgCsv_ParseSensorReporter(&sPrms);
+            eResult = PinCfgCsv_ParseSensorReporter(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         // switches (check after SR to avoid conflict)
-        else if (sPrms.sTempStrPt.szLen >= 1 && sPrms.sTempStrPt.pcStrStart[0] == 'S')
+        else if (psPrms->sTempStrPt.szLen >= 1 && psPrms->sTempStrPt.pcStrStart[0] == 'S')
         {
-            eResult = PinCfgCsv_ParseSwitch(&sPrms);
+            eResult = PinCfgCsv_ParseSwitch(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         // inpins
-        else if (sPrms.sTempStrPt.szLen == 1 && sPrms.sTempStrPt.pcStrStart[0] == 'I')
+        else if (psPrms->sTempStrPt.szLen == 1 && psPrms->sTempStrPt.pcStrStart[0] == 'I')
+        {
+            eResult = PinCfgCsv_ParseInpins(psPrms);
+            if (eResult != PINCFG_OK_E)
+                return eResult;
+        }
+        // composite triggers
+        else if (
+            psPrms->sTempStrPt.szLen == 2 && psPrms->sTempStrPt.pcStrStart[0] == 'T' &&
+            psPrms->sTempStrPt.pcStrStart[1] == 'C')
         {
-            eResult = PinCfgCsv_ParseInpins(&sPrms);
+            eResult = PinCfgCsv_ParseCompositeTriggers(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         // triggers
-        else if (sPrms.sTempStrPt.szLen == 1 && sPrms.sTempStrPt.pcStrStart[0] == 'T')
+        else if (psPrms->sTempStrPt.szLen == 1 && psPrms->sTempStrPt.pcStrStart[0] == 'T')
         {
-            eResult = PinCfgCsv_ParseTriggers(&sPrms);
+            eResult = PinCfgCsv_ParseTriggers(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         // global config items
-        else if (sPrms.sTempStrPt.szLen == 2 && sPrms.sTempStrPt.pcStrStart[0] == 'C')
+        else if (psPrms->sTempStrPt.szLen == 2 && psPrms->sTempStrPt.pcStrStart[0] == 'C')
         {
-            eResult = PinCfgCsv_ParseGlobalConfigItems(&sPrms);
+            eResult = PinCfgCsv_ParseGlobalConfigItems(psPrms);
             if (eResult != PINCFG_OK_E)
                 return eResult;
         }
         else
         {
-            sPrms.pcOutStringLast += LOG_WARNING(&sPrms, "", ERR_UNKNOWN_TYPE);
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, "", ERR_UNKNOWN_TYPE);
         }
     }
 
+#if PINCFG_PROFILER_D
+    if (psPrms->psParsePrms->pszMemoryRequired != NULL)
+    {
+        *(psPrms->psParsePrms->pszMemoryRequired) += Memory_szGetAllocatedSize(
+            sizeof(PROFILER_ENTRY_T) * Profiler_szGetEntriesCount(
+                                           psPrms->u16LoopablesRequired,
+                                           psPrms->u16InPinsRequired,
+                                           psPrms->u16SwitchesRequired));
+    }
+#endif
+
     // Print final summary
 #ifdef PINCFG_USE_ERROR_MESSAGES
-    sPrms.pcOutStringLast += szSafeAppendFormat(
-        sPrms.psParsePrms->pcOutString,
-        sPrms.pcOutStringLast,
-        sPrms.psParsePrms->u16OutStrMaxLen,
+    psPrms->pcOutStringLast += szSafeAppendFormat(
+        psPrms->psParsePrms->pcOutString,
+        psPrms->pcOutStringLast,
+        psPrms->psParsePrms->u16OutStrMaxLen,
         "I: Configuration parsed.\n");
 #else
-    sPrms.pcOutStringLast += szSafeAppendFormat(
-        sPrms.psParsePrms->pcOutString,
-        sPrms.pcOutStringLast,
-        sPrms.psParsePrms->u16OutStrMaxLen,
+    psPrms->pcOutStringLast += szSafeAppendFormat(
+        psPrms->psParsePrms->pcOutString,
+        psPrms->pcOutStringLast,
+        psPrms->psParsePrms->u16OutStrMaxLen,
         "W%zu\n",
-        sPrms.szNumberOfWarnings);
+        psPrms->szNumberOfWarnings);
 #endif
 
-    if (sPrms.szNumberOfWarnings > 0)
+    if (psPrms->szNumberOfWarnings > 0)
         return PINCFG_WARNINGS_E;
 
     return PINCFG_OK_E;
 }
 
-// private
 static PINCFG_RESULT_T PinCfgCsv_CreateCli(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms)
 {
     if (psPrms == NULL)
         return PINCFG_NULLPTR_ERROR_E;
 
+    if (!bTakeChildIds(psPrms, 1U, CLI_E))
+        return PINCFG_INVALID_FORMAT_E;
+
     if (psPrms->psParsePrms->pszMemoryRequired != NULL)
     {
         *(psPrms->psParsePrms->pszMemoryRequired) += Memory_szGetAllocatedSize(sizeof(CLI_T));
-        if (psPrms->psParsePrms->eAddToPresentables != NULL)
-            *(psPrms->psParsePrms->pszMemoryRequired) +=
-                Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-
-        if (psPrms->psParsePrms->eAddToLoopables != NULL)
-            *(psPrms->psParsePrms->pszMemoryRequired) +=
-                Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+        vAddItemsRequirement(psPrms, 1U, 1U);
     }
 
     if (!psPrms->psParsePrms->bValidate)
@@ -571,11 +1365,11 @@ static PINCFG_RESULT_T PinCfgCsv_CreateCli(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms)
             return eAllocResult;
         }
 
-        if (Cli_eInit(psCfgRcvrHnd, psPrms->u8PresentablesCount) == CLI_OK_E)
+        if (Cli_eInit(psCfgRcvrHnd, psPrms->u16PresentablesCount) == CLI_OK_E)
         {
-            PinCfgCsv_eAddToTempPresentables((PRESENTABLE_T *)psCfgRcvrHnd);
-            PinCfgCsv_eAddToTempLoopables(&psCfgRcvrHnd->sLoopable);
-            psPrms->u8PresentablesCount++;
+            PinCfgCsv_eAddToPresentables((PRESENTABLE_T *)psCfgRcvrHnd);
+            PinCfgCsv_eAddToLoopables(&psCfgRcvrHnd->sLoopable);
+            psPrms->u16PresentablesCount++;
         }
         else
         {
@@ -682,23 +1476,29 @@ static PINCFG_RESULT_T PinCfgCsv_ParseSwitch(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms
             }
         }
 
+        if (!bTakeChildIds(psPrms, 1U, SW_E))
+            return PINCFG_INVALID_FORMAT_E;
+
         vGetField(psPrms, u8Offset);
 
-        vAddMemoryRequirement(psPrms, sizeof(SWITCH_T), psPrms->sTempStrPt.szLen, true, true);
+        vAddMemoryRequirement(psPrms, sizeof(SWITCH_T), psPrms->sTempStrPt.szLen, true, false);
+        psPrms->u16SwitchesRequired++;
 
         if (psPrms->psParsePrms->bValidate)
             continue;
 
-        PINCFG_RESULT_T eAllocResult = PINCFG_OK_E;
-        SWITCH_T *psSwitchHnd = (SWITCH_T *)pvAllocOrOOM(psPrms, sizeof(SWITCH_T), SW_E, &eAllocResult);
-        if (psSwitchHnd == NULL)
-            return eAllocResult;
+        if (psGlobals->u16SwitchesCount >= psGlobals->u16SwitchesMax)
+        {
+            psPrms->pcOutStringLast += LOG_ERROR(psPrms, PinCfgMessages_getString(SW_E), ERR_OOM);
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        }
+        SWITCH_T *psSwitchHnd = &psGlobals->pasSwitches[psGlobals->u16SwitchesCount];
 
         bool bInitOk =
             (Switch_eInit(
                  psSwitchHnd,
                  &(psPrms->sTempStrPt),
-                 psPrms->u8PresentablesCount,
+                 psPrms->u16PresentablesCount,
                  eMode,
                  u8Pin,
                  u8FbPin,
@@ -706,7 +1506,9 @@ static PINCFG_RESULT_T PinCfgCsv_ParseSwitch(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms
 
         if (bInitOk)
         {
-            bRegisterComponent(psPrms, (PRESENTABLE_T *)psSwitchHnd, &(psSwitchHnd->sLoopable), SW_E);
+            // looped from the switch array by Switch_vLoopAll
+            if (bRegisterComponent(psPrms, (PRESENTABLE_T *)psSwitchHnd, NULL, SW_E))
+                psGlobals->u16SwitchesCount++;
         }
         else
         {
@@ -748,24 +1550,32 @@ static PINCFG_RESULT_T PinCfgCsv_ParseInpins(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms
             continue;
         }
 
+        if (!bTakeChildIds(psPrms, 1U, IP_E))
+            return PINCFG_INVALID_FORMAT_E;
+
         vGetField(psPrms, u8Offset);
 
-        vAddMemoryRequirement(psPrms, sizeof(INPIN_T), psPrms->sTempStrPt.szLen, true, true);
+        vAddMemoryRequirement(psPrms, sizeof(INPIN_T), psPrms->sTempStrPt.szLen, true, false);
+        psPrms->u16InPinsRequired++;
 
         if (psPrms->psParsePrms->bValidate)
             continue;
 
-        PINCFG_RESULT_T eAllocResult = PINCFG_OK_E;
-        INPIN_T *psInPinHnd = (INPIN_T *)pvAllocOrOOM(psPrms, sizeof(INPIN_T), IP_E, &eAllocResult);
-        if (psInPinHnd == NULL)
-            return eAllocResult;
+        if (psGlobals->u16InPinsCount >= psGlobals->u16InPinsMax)
+        {
+            psPrms->pcOutStringLast += LOG_ERROR(psPrms, PinCfgMessages_getString(IP_E), ERR_OOM);
+            return PINCFG_OUTOFMEMORY_ERROR_E;
+        }
+        INPIN_T *psInPinHnd = &psGlobals->pasInPins[psGlobals->u16InPinsCount];
 
         bool bInitOk =
-            (InPin_eInit(psInPinHnd, &(psPrms->sTempStrPt), psPrms->u8PresentablesCount, u8Pin) == INPIN_OK_E);
+            (InPin_eInit(psInPinHnd, &(psPrms->sTempStrPt), psPrms->u16PresentablesCount, u8Pin) == INPIN_OK_E);
 
         if (bInitOk)
         {
-            bRegisterComponent(psPrms, (PRESENTABLE_T *)psInPinHnd, &(psInPinHnd->sLoopable), IP_E);
+            // looped from the input array by InPin_vLoopAll
+            if (bRegisterComponent(psPrms, (PRESENTABLE_T *)psInPinHnd, NULL, IP_E))
+                psGlobals->u16InPinsCount++;
         }
         else
         {
@@ -806,7 +1616,7 @@ static PINCFG_RESULT_T PinCfgCsv_ParseTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPr
     }
     else
     {
-        psEventPublisherHnd = (IEVENTPUBLISHER_T *)PinCfgCsv_psFindInTempPresentablesByName(&(psPrms->sTempStrPt));
+        psEventPublisherHnd = (IEVENTPUBLISHER_T *)PinCfgCsv_psFindInPresentablesByName(&(psPrms->sTempStrPt));
         if (psEventPublisherHnd == NULL)
         {
             psPrms->pcOutStringLast +=
@@ -870,7 +1680,7 @@ static PINCFG_RESULT_T PinCfgCsv_ParseTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPr
     {
         u8Offset = 5 + i * 2;
         vGetField(psPrms, u8Offset);
-        psSwitchHnd = (SWITCH_T *)PinCfgCsv_psFindInTempPresentablesByName(&(psPrms->sTempStrPt));
+        psSwitchHnd = (SWITCH_T *)PinCfgCsv_psFindInPresentablesByName(&(psPrms->sTempStrPt));
         if (psSwitchHnd == NULL)
         {
             psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_SWITCH_NOT_FOUND);
@@ -909,6 +1719,204 @@ static PINCFG_RESULT_T PinCfgCsv_ParseTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPr
         psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INIT_FAILED);
         return PINCFG_ERROR_E;
     }
+    psTriggerHnd->u16Line = psPrms->u16LinesProcessed;
+
+    return PINCFG_OK_E;
+}
+
+static PINCFG_RESULT_T PinCfgCsv_ParseCompositeTriggers(PINCFG_PARSE_SUBFN_PARAMS_T *psPrms)
+{
+    uint8_t u8Operator, u8CondCount, u8SwCount, u8EventType, u8DrivenAction, u8Offset, u8DrivesCountReal;
+    uint32_t u32HoldMs;
+    int32_t i32EventData;
+    bool bNegate;
+    SWITCH_T *psSwitchHnd;
+    IEVENTPUBLISHER_T *apsPublishers[PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D];
+
+    if (psPrms == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    // TC,name,operator,holdMs,conditionsCount + conditions triples + at least one switch pair
+    if (psPrms->u8LineItemsLen < 10)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_ARGS);
+        return PINCFG_OK_E;
+    }
+
+    if (eParseFieldU8(psPrms, 2, &u8Operator) != PINCFG_STR_OK_E || u8Operator > (uint8_t)COMPOSITETRIGGER_OR_E)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_DEFINITION);
+        return PINCFG_OK_E;
+    }
+
+    if (eParseFieldU32(psPrms, 3, &u32HoldMs) != PINCFG_STR_OK_E)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_TIME_PERIOD);
+        return PINCFG_OK_E;
+    }
+
+    if (eParseFieldU8(psPrms, 4, &u8CondCount) != PINCFG_STR_OK_E || u8CondCount == 0U ||
+        u8CondCount > PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D || psPrms->u8LineItemsLen < 5 + u8CondCount * 3 + 2 ||
+        ((psPrms->u8LineItemsLen - 5 - u8CondCount * 3) % 2) != 0)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_ITEMS);
+        return PINCFG_OK_E;
+    }
+    u8SwCount = (uint8_t)((psPrms->u8LineItemsLen - 5 - u8CondCount * 3) / 2);
+
+    if (psPrms->psParsePrms->pszMemoryRequired != NULL)
+    {
+        *(psPrms->psParsePrms->pszMemoryRequired) +=
+            Memory_szGetAllocatedSize((size_t)sizeof(COMPOSITETRIGGER_CONDITION_T) * (size_t)u8CondCount) +
+            Memory_szGetAllocatedSize((size_t)sizeof(TRIGGER_SWITCHACTION_T) * (size_t)u8SwCount) +
+            Memory_szGetAllocatedSize(sizeof(COMPOSITETRIGGER_T));
+
+        vAddItemsRequirement(psPrms, 0U, (u32HoldMs > 0U) ? 1U : 0U);
+    }
+
+    COMPOSITETRIGGER_CONDITION_T *pasConds = NULL;
+    PINCFG_RESULT_T eAllocResult = PINCFG_OK_E;
+    if (!psPrms->psParsePrms->bValidate)
+    {
+        pasConds = (COMPOSITETRIGGER_CONDITION_T *)pvAllocOrOOM(
+            psPrms, (size_t)sizeof(COMPOSITETRIGGER_CONDITION_T) * (size_t)u8CondCount, TRG_E, &eAllocResult);
+        if (pasConds == NULL)
+            return eAllocResult;
+    }
+
+    // conditions: [!]publisher,eventType,eventData
+    for (uint8_t i = 0; i < u8CondCount; i++)
+    {
+        u8Offset = 5 + i * 3;
+        vGetField(psPrms, u8Offset);
+        bNegate = (psPrms->sTempStrPt.szLen > 1 && psPrms->sTempStrPt.pcStrStart[0] == '!');
+        if (bNegate)
+        {
+            psPrms->sTempStrPt.pcStrStart++;
+            psPrms->sTempStrPt.szLen--;
+        }
+
+        if (psPrms->psParsePrms->bValidate)
+        {
+            if (PinCfgCsv_pcStrstrpt(psPrms->psParsePrms->pcConfig, &(psPrms->sTempStrPt)) == NULL)
+            {
+                psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_SOURCE_NOT_FOUND);
+                return PINCFG_OK_E;
+            }
+        }
+        else
+        {
+            apsPublishers[i] = (IEVENTPUBLISHER_T *)PinCfgCsv_psFindInPresentablesByName(&(psPrms->sTempStrPt));
+            if (apsPublishers[i] == NULL)
+            {
+                psPrms->pcOutStringLast +=
+                    LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_EVENT_PUBLISHER_NOT_FOUND);
+                return PINCFG_OK_E;
+            }
+        }
+
+        if (eParseFieldU8(psPrms, (u8Offset + 1), &u8EventType) != PINCFG_STR_OK_E ||
+            u8EventType > (uint8_t)TRIGGER_ALL_E)
+        {
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_EVENT_TYPE);
+            return PINCFG_OK_E;
+        }
+
+        vGetField(psPrms, (u8Offset + 2));
+        if (PinCfgStr_eAtoFixedPoint(&(psPrms->sTempStrPt), &i32EventData) != PINCFG_STR_OK_E)
+        {
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_EVENT_DATA);
+            return PINCFG_OK_E;
+        }
+        if (u8EventType == (uint8_t)TRIGGER_MULTI_E)
+            i32EventData /= PINCFG_FIXED_POINT_SCALE;
+
+        if (!psPrms->psParsePrms->bValidate)
+        {
+            pasConds[i].eEventType = (TRIGGER_EVENTTYPE_T)u8EventType;
+            pasConds[i].i32EventData = i32EventData;
+            pasConds[i].bNegate = bNegate;
+        }
+    }
+
+    if (psPrms->psParsePrms->bValidate)
+    {
+        for (uint8_t i = 0; i < u8SwCount; i++)
+        {
+            vGetField(psPrms, (5 + u8CondCount * 3 + i * 2));
+            if (PinCfgCsv_pcStrstrpt(psPrms->psParsePrms->pcConfig, &(psPrms->sTempStrPt)) == NULL)
+                psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_SOURCE_NOT_FOUND);
+        }
+        return PINCFG_OK_E;
+    }
+
+    TRIGGER_SWITCHACTION_T *pasSwActs = (TRIGGER_SWITCHACTION_T *)pvAllocOrOOM(
+        psPrms, (size_t)sizeof(TRIGGER_SWITCHACTION_T) * (size_t)u8SwCount, TRG_E, &eAllocResult);
+    if (pasSwActs == NULL)
+        return eAllocResult;
+
+    u8DrivesCountReal = 0;
+    for (uint8_t i = 0; i < u8SwCount; i++)
+    {
+        u8Offset = 5 + u8CondCount * 3 + i * 2;
+        vGetField(psPrms, u8Offset);
+        psSwitchHnd = (SWITCH_T *)PinCfgCsv_psFindInPresentablesByName(&(psPrms->sTempStrPt));
+        if (psSwitchHnd == NULL)
+        {
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_SWITCH_NOT_FOUND);
+            continue;
+        }
+
+        if (eParseFieldU8(psPrms, (u8Offset + 1), &u8DrivenAction) != PINCFG_STR_OK_E ||
+            u8DrivenAction > (uint8_t)TRIGGER_A_FORWARD_E)
+        {
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INVALID_SWITCH_ACTION);
+            continue;
+        }
+
+        pasSwActs[u8DrivesCountReal].psSwitchHnd = psSwitchHnd;
+        pasSwActs[u8DrivesCountReal].eAction = (TRIGGER_ACTION_T)u8DrivenAction;
+
+        u8DrivesCountReal++;
+    }
+
+    if (u8DrivesCountReal == 0U)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_NOTHING_TO_DRIVE);
+        return PINCFG_OK_E;
+    }
+
+    COMPOSITETRIGGER_T *psCompositeHnd =
+        (COMPOSITETRIGGER_T *)pvAllocOrOOM(psPrms, sizeof(COMPOSITETRIGGER_T), TRG_E, &eAllocResult);
+    if (psCompositeHnd == NULL)
+        return eAllocResult;
+
+    if (CompositeTrigger_eInit(
+            psCompositeHnd,
+            pasConds,
+            u8CondCount,
+            pasSwActs,
+            u8DrivesCountReal,
+            (COMPOSITETRIGGER_OPERATOR_T)u8Operator,
+            u32HoldMs) != COMPOSITETRIGGER_OK_E)
+    {
+        psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INIT_FAILED);
+        return PINCFG_ERROR_E;
+    }
+
+    for (uint8_t i = 0; i < u8CondCount; i++)
+    {
+        if (EventPublisher_eAddSubscriber(apsPublishers[i], (IEVENTSUBSCRIBER_T *)&pasConds[i]) !=
+            EVENTSUBSCRIBER_OK_E)
+        {
+            psPrms->pcOutStringLast += LOG_WARNING(psPrms, PinCfgMessages_getString(TRG_E), ERR_INIT_FAILED);
+            return PINCFG_ERROR_E;
+        }
+    }
+
+    // hold time is measured from the loop
+    if (u32HoldMs > 0U)
+        bRegisterComponent(psPrms, NULL, &psCompositeHnd->sLoopable, TRG_E);
 
     return PINCFG_OK_E;
 }
@@ -949,7 +1957,8 @@ static PINCFG_RESULT_T PinCfgCsv_ParseMeasurementSource(PINCFG_PARSE_SUBFN_PARAM
             szMeasurementSize = sizeof(CPUTEMPMEASURE_T); // Fallback for unsupported types
 
         *(psPrms->psParsePrms->pszMemoryRequired) +=
-            Memory_szGetAllocatedSize(szMeasurementSize) + Memory_szGetAllocatedSize(psPrms->sTempStrPt.szLen + 1);
+            Memory_szGetAllocatedSize(szMeasurementSize) +
+            Memory_szGetNameAllocatedSize(psPrms->sTempStrPt.szLen, &psPrms->szNameChunkLeft);
         return PINCFG_OK_E;
     }
 
@@ -1579,22 +2588,24 @@ static PINCFG_RESULT_T PinCfgCsv_ParseSensorReporter(PINCFG_PARSE_SUBFN_PARAMS_T
         }
     }
 
+    // the enableable is a presentable of its own
+    if (!bTakeChildIds(psPrms, (u8Enableable != 0U) ? 2U : 1U, SR_E))
+        return PINCFG_INVALID_FORMAT_E;
+
     // Calculate memory
     if (psPrms->psParsePrms->pszMemoryRequired != NULL)
     {
         *(psPrms->psParsePrms->pszMemoryRequired) +=
-            Memory_szGetAllocatedSize(sizeof(SENSOR_T)) + Memory_szGetAllocatedSize(sSensorName.szLen + 1);
+            Memory_szGetAllocatedSize(sizeof(SENSOR_T)) +
+            Memory_szGetNameAllocatedSize(sSensorName.szLen, &psPrms->szNameChunkLeft);
 
         // Add unit string memory if provided
         if (sUnit.szLen > 0)
-            *(psPrms->psParsePrms->pszMemoryRequired) += Memory_szGetAllocatedSize(sUnit.szLen + 1);
-
-        if (psPrms->psParsePrms->eAddToPresentables != NULL)
-            *(psPrms->psParsePrms->pszMemoryRequired) +=
-                Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-        if (psPrms->psParsePrms->eAddToLoopables != NULL)
             *(psPrms->psParsePrms->pszMemoryRequired) +=
-                Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+                Memory_szGetNameAllocatedSize(sUnit.szLen, &psPrms->szNameChunkLeft);
+
+        // the enableable is a presentable of its own
+        vAddItemsRequirement(psPrms, (u8Enableable != 0U) ? 2U : 1U, 1U);
         return PINCFG_OK_E;
     }
 
@@ -1613,7 +2624,7 @@ static PINCFG_RESULT_T PinCfgCsv_ParseSensorReporter(PINCFG_PARSE_SUBFN_PARAMS_T
     bool bInitOk =
         (Sensor_eInit(
              psSensorHandle,
-             &psPrms->u8PresentablesCount,
+             &psPrms->u16PresentablesCount,
              (bool)u8Cumulative,
              (bool)u8Enableable,
              &sSensorName,
@@ -1726,12 +2737,12 @@ static PINCFG_RESULT_T PinCfgCsv_ParseGlobalConfigItems(PINCFG_PARSE_SUBFN_PARAM
     return PINCFG_OK_E;
 }
 
-static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesById(uint8_t u8Id)
+static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesById(uint16_t u16Id)
 {
-    if (u8Id >= psGlobals->u8PresentablesCount)
+    if (u16Id >= psGlobals->u16PresentablesCount)
         return NULL;
 
-    return (psGlobals->ppsPresentables)[u8Id];
+    return (psGlobals->ppsPresentables)[u16Id];
 }
 
 static ISENSORMEASURE_T *PinCfgCsv_psFindMeasurementByName(
@@ -1765,23 +2776,17 @@ static ISENSORMEASURE_T *PinCfgCsv_psFindMeasurementByName(
     return NULL; // Not found
 }
 
-static PRESENTABLE_T *PinCfgCsv_psFindInTempPresentablesByName(const STRING_POINT_T *psName)
+static PRESENTABLE_T *PinCfgCsv_psFindInPresentablesByName(const STRING_POINT_T *psName)
 {
-    PRESENTABLE_T *psReturn = NULL;
-
-    LINKEDLIST_ITEM_T *psLLItem = (LINKEDLIST_ITEM_T *)psGlobals->ppsPresentables;
-    while (psLLItem != NULL)
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
     {
-        psReturn = (PRESENTABLE_T *)LinkedList_pvGetStoredItem(psLLItem);
-        size_t szPcHeyNameLength = strlen(psReturn->pcName);
-        if (szPcHeyNameLength == psName->szLen && memcmp(psName->pcStrStart, psReturn->pcName, szPcHeyNameLength) == 0)
-            break;
-
-        psLLItem = LinkedList_psGetNext(psLLItem);
-        psReturn = NULL;
+        PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[i];
+        size_t szPcHeyNameLength = strlen(psCurrent->pcName);
+        if (szPcHeyNameLength == psName->szLen && memcmp(psName->pcStrStart, psCurrent->pcName, szPcHeyNameLength) == 0)
+            return psCurrent;
     }
 
-    return psReturn;
+    return NULL;
 }
 
 size_t szGetSize(size_t a, size_t b)
@@ -1802,12 +2807,28 @@ static PINCFG_RESULT_T PinCfgCsv_eAddToLinkedList(LINKEDLIST_ITEM_T **psFirst, v
     return PINCFG_OK_E;
 }
 
-PINCFG_RESULT_T PinCfgCsv_eAddToTempLoopables(LOOPABLE_T *psLoopable)
+PINCFG_RESULT_T PinCfgCsv_eAddToLoopables(LOOPABLE_T *psLoopable)
 {
-    return PinCfgCsv_eAddToLinkedList((LINKEDLIST_ITEM_T **)&(psGlobals->ppsLoopables), (void *)psLoopable);
+    if (psLoopable == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    if (psGlobals->u16LoopablesCount >= psGlobals->u16LoopablesMax)
+        return PINCFG_OUTOFMEMORY_ERROR_E;
+
+    psGlobals->ppsLoopables[psGlobals->u16LoopablesCount++] = psLoopable;
+
+    return PINCFG_OK_E;
 }
 
-PINCFG_RESULT_T PinCfgCsv_eAddToTempPresentables(PRESENTABLE_T *psPresentable)
+PINCFG_RESULT_T PinCfgCsv_eAddToPresentables(PRESENTABLE_T *psPresentable)
 {
-    return PinCfgCsv_eAddToLinkedList((LINKEDLIST_ITEM_T **)&(psGlobals->ppsPresentables), (void *)psPresentable);
+    if (psPresentable == NULL)
+        return PINCFG_NULLPTR_ERROR_E;
+
+    if (psGlobals->u16PresentablesCount >= psGlobals->u16PresentablesMax)
+        return PINCFG_OUTOFMEMORY_ERROR_E;
+
+    psGlobals->ppsPresentables[psGlobals->u16PresentablesCount++] = psPresentable;
+
+    return PINCFG_OK_E;
 }
@@ -4,6 +4,7 @@
 #include "ILoopable.h"
 #include "LinkedList.h"
 #include "MySensorsWrapper.h"
+#include "PinCfgStatic.h"
 #include "Presentable.h"
 #include "Types.h"
 
@@ -29,6 +30,17 @@ typedef enum PINCFG_RESULT_E
     PINCFG_WARNINGS_E
 } PINCFG_RESULT_T;
 
+typedef enum PINCFG_PRESENTATION_STATE_E
+{
+    PINCFG_PRESENTATION_IDLE_E = 0,
+    PINCFG_PRESENTATION_PRESENTING_E,
+    PINCFG_PRESENTATION_INITIAL_STATES_E
+} PINCFG_PRESENTATION_STATE_T;
+
+// One pinCfg instance. The functions without context work on the active instance of the calling thread,
+// the *Ctx variants make psCtx the active one first.
+typedef struct PINCFG_CTX_S PINCFG_CTX_T;
+
 typedef struct PINCFG_PARSE_PARAMS_S
 {
     const char *pcConfig;
@@ -42,7 +54,9 @@ typedef struct PINCFG_PARSE_PARAMS_S
 
 void PinCfgCsv_vLoop(uint32_t u32ms);
 
+// Presents the first item and schedules the rest, one per PINCFG_PRESENTATION_INTERVAL_MS_D, from PinCfgCsv_vLoop
 void PinCfgCsv_vPresentation(void);
+bool PinCfgCsv_bPresentationDone(void);
 
 void PinCfgCsv_vReceiveMessage(const MyMessage *message);
 
@@ -52,11 +66,43 @@ PINCFG_RESULT_T PinCfgCsv_eValidate(
     char *pcOutString,
     const uint16_t u16OutStrMaxLen);
 
+// Edits config text by component name into pcOut (pcOut may be pcConfig). Lines are keyed by their first
+// component name, global items by their type. pcPatch holds lines separated by PINCFG_LINE_SEPARATOR_D: "-name"
+// deletes the line with that key, any other line replaces the line with its key or is appended.
+// PINCFG_ERROR_E if a deleted key is not found.
+PINCFG_RESULT_T PinCfgCsv_ePatch(const char *pcConfig, const char *pcPatch, char *pcOut, size_t szOutMax);
+
 PINCFG_RESULT_T PinCfgCsv_eInit(uint8_t *pu8Memory, size_t szMemorySize, const char *pcDefaultCfg);
 
+// Instantiates a config generated into const tables (PinCfgStatic.h) instead of parsing one, the stored config is
+// not loaded. Component names are not copied to memory.
+PINCFG_RESULT_T PinCfgCsv_eInitStatic(uint8_t *pu8Memory, size_t szMemorySize, const PINCFG_STATIC_CFG_T *psCfg);
+
+// Replaces the running config with the stored one without a reset. Persisted states of components whose names
+// match are carried over and only children with a changed id, name or type are presented again. If the stored
+// config cannot be loaded the running one stays.
+PINCFG_RESULT_T PinCfgCsv_eReload(void);
+// PinCfgCsv_eReload() at the start of the next PinCfgCsv_vLoop(), safe from within a component
+void PinCfgCsv_vRequestReload(void);
+
+// *ppsCtx NULL creates a new instance (in static mode it is placed at the start of pu8Memory),
+// otherwise that instance is initialized again
+PINCFG_RESULT_T PinCfgCsv_eInitCtx(
+    PINCFG_CTX_T **ppsCtx,
+    uint8_t *pu8Memory,
+    size_t szMemorySize,
+    const char *pcDefaultCfg);
+void PinCfgCsv_vLoopCtx(PINCFG_CTX_T *psCtx, uint32_t u32ms);
+void PinCfgCsv_vPresentationCtx(PINCFG_CTX_T *psCtx);
+bool PinCfgCsv_bPresentationDoneCtx(PINCFG_CTX_T *psCtx);
+void PinCfgCsv_vReceiveMessageCtx(PINCFG_CTX_T *psCtx, const MyMessage *message);
+PINCFG_CTX_T *PinCfgCsv_psGetCtx(void);
+void PinCfgCsv_vSetCtx(PINCFG_CTX_T *psCtx);
+
 PINCFG_RESULT_T PinCfgCsv_eParse(PINCFG_PARSE_PARAMS_T *psParams);
 
-PINCFG_RESULT_T PinCfgCsv_eAddToTempLoopables(LOOPABLE_T *psLoopable);
-PINCFG_RESULT_T PinCfgCsv_eAddToTempPresentables(PRESENTABLE_T *psPresentable);
+// Append to the arrays PinCfgCsv_eParse allocates from its counting pass
+PINCFG_RESULT_T PinCfgCsv_eAddToLoopables(LOOPABLE_T *psLoopable);
+PINCFG_RESULT_T PinCfgCsv_eAddToPresentables(PRESENTABLE_T *psPresentable);
 
 #endif // PINCFGCSV_H
@@ -49,7 +49,8 @@ static const char *_errorMessages[] = {
     "Invalid I2C address",           // 36 - ERR_INVALID_I2C_ADDRESS
     "Invalid I2C command",           // 37 - ERR_INVALID_I2C_CMD
     "Invalid data size",             // 38 - ERR_INVALID_DATA_SIZE
-    "Invalid global config"          // 39 - ERR_INVALID_GLOBAL_CFG
+    "Invalid global config",         // 39 - ERR_INVALID_GLOBAL_CFG
+    "Too many child ids"             // 40 - ERR_TOO_MANY_CHILD_IDS
 };
 #endif
 
@@ -49,7 +49,8 @@ typedef enum PINCFG_ERROR_CODE_E
     ERR_INVALID_I2C_ADDRESS,
     ERR_INVALID_I2C_CMD,
     ERR_INVALID_DATA_SIZE,
-    ERR_INVALID_GLOBAL_CFG
+    ERR_INVALID_GLOBAL_CFG,
+    ERR_TOO_MANY_CHILD_IDS
 } PINCFG_ERROR_CODE_T;
 
 // Parse string indices - used for accessing common strings
@@ -15,11 +15,17 @@ typedef struct PINCFG_PARSE_SUBFN_PARAMS_S
     size_t pcOutStringLast;
     uint16_t u16LinesProcessed;
     uint8_t u8LineItemsLen;
-    uint8_t u8PresentablesCount;
+    uint16_t u16PresentablesCount;
+    uint16_t u16PresentablesRequired; // counted by the memory calculation
+    uint16_t u16ChildIds;             // taken in every pass, see bTakeChildIds
+    uint16_t u16LoopablesRequired;
+    uint16_t u16SwitchesRequired;
+    uint16_t u16InPinsRequired;
     size_t szNumberOfWarnings;
     STRING_POINT_T sLine;
     STRING_POINT_T sTempStrPt;
     LINKEDLIST_ITEM_T *psMeasurementsListHead; // Measurements during parsing only
+    size_t szNameChunkLeft;                    // memory calculation of packed names
 } PINCFG_PARSE_SUBFN_PARAMS_T;
 
 #endif // PINCFG_PARSE_H
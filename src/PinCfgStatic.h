@@ -0,0 +1,75 @@
+#ifndef PINCFGSTATIC_H
+#define PINCFGSTATIC_H
+
+#include "Types.h"
+
+// Config compiled into const tables by config/src/build-static-config.py, instantiated by PinCfgCsv_eInitStatic()
+// without parsing. Names stay in the tables, references between components are resolved to array indexes by the
+// generator. Ids are the ones the parser assigns to the same config: CLI 0, then switches and inputs in line order.
+// On AVR the generator puts the tables and names in PROGMEM, they are read with PINCFG_STATIC_READ and the names
+// are copied to the arena like parsed names. On ARM and ESP const data is in flash already, names are used in place.
+
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h>
+#define PINCFG_STATIC_ATTR PROGMEM
+#define PINCFG_STATIC_READ(pvDst, pvSrc, szSize) memcpy_P((pvDst), (pvSrc), (szSize))
+#else
+#include <string.h>
+#define PINCFG_STATIC_ATTR
+#define PINCFG_STATIC_READ(pvDst, pvSrc, szSize) memcpy((pvDst), (pvSrc), (szSize))
+#endif // ARDUINO_ARCH_AVR
+
+// global config item not set
+#define PINCFG_STATIC_DEFAULT 0xFFFFFFFFUL
+
+typedef struct PINCFG_STATIC_SWITCH_S
+{
+    const char *pcName;
+    uint32_t u32TimedPeriodMs;
+    uint16_t u16Id;
+    uint8_t u8Mode; // SWITCH_MODE_T
+    uint8_t u8Pin;
+    uint8_t u8FbPin; // 0 without feedback
+} PINCFG_STATIC_SWITCH_T;
+
+typedef struct PINCFG_STATIC_INPIN_S
+{
+    const char *pcName;
+    uint16_t u16Id;
+    uint8_t u8Pin;
+} PINCFG_STATIC_INPIN_T;
+
+typedef struct PINCFG_STATIC_SWITCHACTION_S
+{
+    uint16_t u16Switch; // index into pasSwitches
+    uint8_t u8Action;   // TRIGGER_ACTION_T
+} PINCFG_STATIC_SWITCHACTION_T;
+
+typedef struct PINCFG_STATIC_TRIGGER_S
+{
+    int32_t i32EventData;     // as parsed, fixed point except the MULTI click count
+    uint16_t u16InPin;        // publisher, index into pasInPins
+    uint16_t u16FirstAction;  // index into pasActions
+    uint16_t u16Line;         // config line, for the event trace
+    uint8_t u8ActionsCount;
+    uint8_t u8EventType;      // TRIGGER_EVENTTYPE_T
+} PINCFG_STATIC_TRIGGER_T;
+
+typedef struct PINCFG_STATIC_CFG_S
+{
+    const PINCFG_STATIC_SWITCH_T *pasSwitches;
+    const PINCFG_STATIC_INPIN_T *pasInPins;
+    const PINCFG_STATIC_TRIGGER_T *pasTriggers;
+    const PINCFG_STATIC_SWITCHACTION_T *pasActions;
+    // global config items, PINCFG_STATIC_DEFAULT keeps the default
+    uint32_t u32InPinDebounceMs;
+    uint32_t u32InPinMulticlickMaxDelayMs;
+    uint32_t u32SwitchImpulseDurationMs;
+    uint32_t u32SwitchFbDelayMs;
+    uint16_t u16SwitchesCount;
+    uint16_t u16InPinsCount;
+    uint16_t u16TriggersCount;
+    uint16_t u16ActionsCount;
+} PINCFG_STATIC_CFG_T;
+
+#endif // PINCFGSTATIC_H
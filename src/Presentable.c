@@ -6,17 +6,19 @@
 #include "Globals.h"
 #include "Memory.h"
 #include "MySensorsWrapper.h"
+#include "StateJournal.h"
 
 // Formatting
 static const char *Presentable_pcFormatDecimal(int32_t i32Value, uint8_t u8Precision, char *pcBuffer, size_t szBufSize);
+static WRAP_RESULT_T Presentable_eStateMessageInit(PRESENTABLE_T *psHandle, MyMessage *psMsg);
 
-PRESENTABLE_RESULT_T Presentable_eInitReuseName(PRESENTABLE_T *psHandle, const char *pcName, uint8_t u8Id)
+PRESENTABLE_RESULT_T Presentable_eInitReuseName(PRESENTABLE_T *psHandle, const char *pcName, uint16_t u16Id)
 {
     if (psHandle == NULL || pcName == NULL)
         return PRESENTABLE_NULLPTR_ERROR_E;
 
     psHandle->pcName = pcName;
-    psHandle->u8Id = u8Id;
+    psHandle->u16Id = u16Id;
     psHandle->u32State = 0UL;
     psHandle->u8Flags = 0U;
     psHandle->ePayloadType = P_BYTE;
@@ -25,24 +27,24 @@ PRESENTABLE_RESULT_T Presentable_eInitReuseName(PRESENTABLE_T *psHandle, const c
     return PRESENTABLE_OK_E;
 }
 
-PRESENTABLE_RESULT_T Presentable_eInit(PRESENTABLE_T *psHandle, STRING_POINT_T *psName, uint8_t u8Id)
+PRESENTABLE_RESULT_T Presentable_eInit(PRESENTABLE_T *psHandle, STRING_POINT_T *psName, uint16_t u16Id)
 {
     if (psHandle == NULL || psName == NULL)
         return PRESENTABLE_NULLPTR_ERROR_E;
 
-    char *pcName = (char *)Memory_vpAlloc(psName->szLen + 1);
+    char *pcName = Memory_pcNameAlloc(psName->szLen);
     if (pcName == NULL)
         return PRESENTABLE_ALLOCATION_ERROR_E;
 
     memcpy((void *)pcName, (const void *)psName->pcStrStart, (size_t)psName->szLen);
     pcName[psName->szLen] = '\0';
 
-    return Presentable_eInitReuseName(psHandle, pcName, u8Id);
+    return Presentable_eInitReuseName(psHandle, pcName, u16Id);
 }
 
-uint8_t Presentable_u8GetId(PRESENTABLE_T *psHandle)
+uint16_t Presentable_u16GetId(PRESENTABLE_T *psHandle)
 {
-    return psHandle->u8Id;
+    return psHandle->u16Id;
 }
 
 const char *Presentable_pcGetName(PRESENTABLE_T *psHandle)
@@ -65,13 +67,17 @@ void Presentable_vSetState(PRESENTABLE_T *psHandle, int32_t i32State, bool bSend
     psHandle->i32State = (i32State & u32Mask);
 
     if (i32OldState != psHandle->i32State)
+    {
         psHandle->u8Flags |= PRESENTABLE_FLAG_STATE_CHANGED;
+        if (psHandle->u8Flags & PRESENTABLE_FLAG_PERSIST)
+            StateJournal_vMarkDirty();
+    }
 #ifdef MY_CONTROLLER_HA
     if (bSendStatus && (psHandle->u8Flags & PRESENTABLE_FLAG_STATE_PRESENTED))
 #else
     if (bSendStatus)
 #endif
-        Presentable_vSendState(psHandle);
+        Presentable_vQueueState(psHandle);
 }
 
 uint8_t Presentable_u8GetState(PRESENTABLE_T *psHandle)
@@ -92,7 +98,9 @@ void Presentable_vToggle(PRESENTABLE_T *psHandle)
         psHandle->u8State = (uint8_t) false;
 
     psHandle->u8Flags |= PRESENTABLE_FLAG_STATE_CHANGED;
-    Presentable_vSendState(psHandle);
+    if (psHandle->u8Flags & PRESENTABLE_FLAG_PERSIST)
+        StateJournal_vMarkDirty();
+    Presentable_vQueueState(psHandle);
 }
 
 void Presentable_vRcvMessage(PRESENTABLE_T *psHandle, const MyMessage *pcMsg)
@@ -106,18 +114,37 @@ void Presentable_vRcvMessage(PRESENTABLE_T *psHandle, const MyMessage *pcMsg)
 
 void Presentable_vPresent(PRESENTABLE_T *psHandle)
 {
-    ePresent(psHandle->u8Id, psHandle->psVtab->eSType, psHandle->pcName, false);
+    ePresent(psHandle->u16Id, psHandle->psVtab->eSType, psHandle->pcName, false);
 }
 
 void Presentable_vPresentState(PRESENTABLE_T *psHandle)
 {
     Presentable_vSendState(psHandle);
-    eRequest(psHandle->u8Id, psHandle->psVtab->eVType, GATEWAY_ADDRESS);
+    eRequest(psHandle->u16Id, psHandle->psVtab->eVType, GATEWAY_ADDRESS);
 }
 
 void Presentable_vSendState(PRESENTABLE_T *psHandle)
 {
     MyMessage msg;
+
+    if (Presentable_eStateMessageInit(psHandle, &msg) != WRAP_OK_E)
+        return;
+
+    eSend(&msg, false);
+}
+
+void Presentable_vQueueState(PRESENTABLE_T *psHandle)
+{
+    MyMessage msg;
+
+    if (Presentable_eStateMessageInit(psHandle, &msg) != WRAP_OK_E)
+        return;
+
+    eSendQueued(&psGlobals->sSendQueue, &msg);
+}
+
+static WRAP_RESULT_T Presentable_eStateMessageInit(PRESENTABLE_T *psHandle, MyMessage *psMsg)
+{
     mysensors_payload_t ePayloadType = psHandle->ePayloadType;
     const char *pcValue = psHandle->pcState;
     char acBuffer[16];
@@ -129,10 +156,7 @@ void Presentable_vSendState(PRESENTABLE_T *psHandle)
         ePayloadType = P_STRING;
     }
 
-    if (eMyMessageInit(&msg, psHandle->u8Id, psHandle->psVtab->eVType, ePayloadType, pcValue) != WRAP_OK_E)
-        return;
-
-    eSend(&msg, false);
+    return eMyMessageInit(psMsg, psHandle->u16Id, psHandle->psVtab->eVType, ePayloadType, pcValue);
 }
 
 const char *Presentable_pcFormatDecimal(int32_t i32Value, uint8_t u8Precision, char *pcBuffer, size_t szBufSize)
@@ -30,7 +30,7 @@ typedef struct PRESENTABLE_S
         const char *pcState;
     };
     mysensors_payload_t ePayloadType;
-    uint8_t u8Id;
+    uint16_t u16Id;
     uint8_t u8Precision; // Decimal places for string formatting (0 = integer)
     uint8_t u8Flags;     // Status flags - saves 4 bytes (eliminates padding)
 } PRESENTABLE_T;
@@ -38,6 +38,8 @@ typedef struct PRESENTABLE_S
 // Presentable flag bit masks (upper bits, lower bits reserved for future use)
 #define PRESENTABLE_FLAG_STATE_CHANGED 0x10   // State has changed, needs processing
 #define PRESENTABLE_FLAG_STATE_PRESENTED 0x20 // Controller has acknowledged this presentable
+#define PRESENTABLE_FLAG_PERSIST 0x40         // State is kept in the state journal across resets
+#define PRESENTABLE_FLAG_PRESENT_PENDING 0x80 // Waits for the paced presentation
 
 typedef enum
 {
@@ -48,10 +50,10 @@ typedef enum
     PRESENTABLE_ERROR_E
 } PRESENTABLE_RESULT_T;
 
-PRESENTABLE_RESULT_T Presentable_eInitReuseName(PRESENTABLE_T *psHandle, const char *pcName, uint8_t u8Id);
-PRESENTABLE_RESULT_T Presentable_eInit(PRESENTABLE_T *psHandle, STRING_POINT_T *psName, uint8_t u8Id);
+PRESENTABLE_RESULT_T Presentable_eInitReuseName(PRESENTABLE_T *psHandle, const char *pcName, uint16_t u16Id);
+PRESENTABLE_RESULT_T Presentable_eInit(PRESENTABLE_T *psHandle, STRING_POINT_T *psName, uint16_t u16Id);
 
-uint8_t Presentable_u8GetId(PRESENTABLE_T *psHandle);
+uint16_t Presentable_u16GetId(PRESENTABLE_T *psHandle);
 const char *Presentable_pcGetName(PRESENTABLE_T *psHandle);
 void Presentable_vSetState(PRESENTABLE_T *psHandle, int32_t i32State, bool bSendStatus);
 uint8_t Presentable_u8GetState(PRESENTABLE_T *psHandle);
@@ -61,5 +63,7 @@ void Presentable_vRcvMessage(PRESENTABLE_T *psHandle, const MyMessage *pcMsg);
 void Presentable_vPresent(PRESENTABLE_T *psHandle);
 void Presentable_vPresentState(PRESENTABLE_T *psHandle);
 void Presentable_vSendState(PRESENTABLE_T *psHandle);
+// rate limited and coalesced with pending updates of the same presentable, see eSendQueued()
+void Presentable_vQueueState(PRESENTABLE_T *psHandle);
 
 #endif // PRESENTABLE_H
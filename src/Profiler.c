@@ -0,0 +1,200 @@
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Cli.h"
+#include "Globals.h"
+#include "MySensorsWrapper.h"
+#include "Sensor.h"
+
+#if PINCFG_PROFILER_D
+#if !defined(UNIT_TEST) && (defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_ARCH_STM32F1))
+#include <Arduino.h>
+
+#define PROFILER_UNIT "cyc"
+
+static inline uint32_t Profiler_u32Now(void)
+{
+    return DWT->CYCCNT;
+}
+#else
+#define PROFILER_UNIT "us"
+
+static inline uint32_t Profiler_u32Now(void)
+{
+    return u32Micros();
+}
+#endif
+
+// "/<name>,<count>,<total>,<max>" without the name
+#define PROFILER_ENTRY_TEXT_SZ (4U + 3U * 10U)
+
+static void Profiler_vRecord(PROFILER_ENTRY_T *psEntry, uint32_t u32Start)
+{
+    uint32_t u32Spent = Profiler_u32Now() - u32Start;
+
+    psEntry->u32Count++;
+    psEntry->u32Total = (psEntry->u32Total > UINT32_MAX - u32Spent) ? UINT32_MAX : psEntry->u32Total + u32Spent;
+    if (u32Spent > psEntry->u32Max)
+        psEntry->u32Max = u32Spent;
+}
+
+// the CLI and sensors carry their loopable, a sensor is recognized by its own vtab
+static const char *Profiler_pcGetLoopableName(const LOOPABLE_T *psLoopable)
+{
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+    {
+        PRESENTABLE_T *psPresentable = psGlobals->ppsPresentables[i];
+        SENSOR_T *psSensor = (SENSOR_T *)psPresentable;
+
+        if ((i == 0 && &((CLI_T *)psPresentable)->sLoopable == psLoopable) ||
+            (psPresentable->psVtab == &psSensor->sVtab && &psSensor->sLoopable == psLoopable))
+            return Presentable_pcGetName(psPresentable);
+    }
+
+    return NULL;
+}
+
+static size_t Profiler_szAppend(
+    char *pcOut,
+    size_t szOutMax,
+    size_t szLen,
+    const char *pcName,
+    uint16_t u16LoopIdx,
+    PROFILER_ENTRY_T *psEntry)
+{
+    if (szLen + 1 >= szOutMax)
+        return szLen;
+
+    int iLen;
+    if (pcName != NULL)
+        iLen = snprintf(&pcOut[szLen], szOutMax - szLen, "/%s,", pcName);
+    else
+        iLen = snprintf(&pcOut[szLen], szOutMax - szLen, "/#%u,", (unsigned)u16LoopIdx);
+    if (iLen > 0)
+        szLen += (size_t)iLen;
+
+    if (szLen + 1 < szOutMax)
+    {
+        iLen = snprintf(
+            &pcOut[szLen],
+            szOutMax - szLen,
+            "%lu,%lu,%lu",
+            (unsigned long)psEntry->u32Count,
+            (unsigned long)psEntry->u32Total,
+            (unsigned long)psEntry->u32Max);
+        if (iLen > 0)
+            szLen += (size_t)iLen;
+    }
+    memset(psEntry, 0, sizeof(PROFILER_ENTRY_T));
+
+    return (szLen < szOutMax) ? szLen : szOutMax - 1;
+}
+#endif // PINCFG_PROFILER_D
+
+size_t Profiler_szGetEntriesCount(uint16_t u16Loopables, uint16_t u16InPins, uint16_t u16Switches)
+{
+    return (size_t)u16Loopables + (size_t)u16InPins + (size_t)u16Switches;
+}
+
+void Profiler_vInit(void)
+{
+#if PINCFG_PROFILER_D && !defined(UNIT_TEST) && (defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_ARCH_STM32F1))
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void Profiler_vLoopAll(uint32_t u32ms)
+{
+#if PINCFG_PROFILER_D
+    PROFILER_ENTRY_T *pasEntries = psGlobals->pasProfile;
+    uint32_t u32Start;
+
+    for (uint16_t i = 0; i < psGlobals->u16LoopablesCount; i++)
+    {
+        LOOPABLE_T *psCurrent = psGlobals->ppsLoopables[i];
+        u32Start = Profiler_u32Now();
+        psCurrent->vLoop(psCurrent, u32ms);
+        Profiler_vRecord(&pasEntries[i], u32Start);
+    }
+
+    // outputs last, like the unprofiled loop
+    pasEntries += psGlobals->u16LoopablesMax;
+    for (uint16_t i = 0; i < psGlobals->u16InPinsCount; i++)
+    {
+        LOOPABLE_T *psCurrent = &psGlobals->pasInPins[i].sLoopable;
+        u32Start = Profiler_u32Now();
+        psCurrent->vLoop(psCurrent, u32ms);
+        Profiler_vRecord(&pasEntries[i], u32Start);
+    }
+
+    pasEntries += psGlobals->u16InPinsMax;
+    for (uint16_t i = 0; i < psGlobals->u16SwitchesCount; i++)
+    {
+        LOOPABLE_T *psCurrent = &psGlobals->pasSwitches[i].sLoopable;
+        u32Start = Profiler_u32Now();
+        psCurrent->vLoop(psCurrent, u32ms);
+        Profiler_vRecord(&pasEntries[i], u32Start);
+    }
+#else
+    (void)u32ms;
+#endif
+}
+
+size_t Profiler_szGetTextSize(void)
+{
+    size_t szSize = 8U;
+#if PINCFG_PROFILER_D
+    for (uint16_t i = 0; i < psGlobals->u16LoopablesCount; i++)
+    {
+        const char *pcName = Profiler_pcGetLoopableName(psGlobals->ppsLoopables[i]);
+        szSize += PROFILER_ENTRY_TEXT_SZ + ((pcName != NULL) ? strlen(pcName) : 6U);
+    }
+    for (uint16_t i = 0; i < psGlobals->u16InPinsCount; i++)
+        szSize += PROFILER_ENTRY_TEXT_SZ + strlen(Presentable_pcGetName(&psGlobals->pasInPins[i].sPresentable));
+    for (uint16_t i = 0; i < psGlobals->u16SwitchesCount; i++)
+        szSize += PROFILER_ENTRY_TEXT_SZ + strlen(Presentable_pcGetName(&psGlobals->pasSwitches[i].sPresentable));
+#endif
+
+    return szSize;
+}
+
+size_t Profiler_szReadAndReset(char *pcOut, size_t szOutMax)
+{
+    if (pcOut == NULL || szOutMax == 0)
+        return 0;
+
+    pcOut[0] = '\0';
+#if PINCFG_PROFILER_D
+    int iLen = snprintf(pcOut, szOutMax, "U:%s", PROFILER_UNIT);
+    size_t szLen = (iLen > 0 && (size_t)iLen < szOutMax) ? (size_t)iLen : 0;
+    PROFILER_ENTRY_T *pasEntries = psGlobals->pasProfile;
+
+    for (uint16_t i = 0; i < psGlobals->u16LoopablesCount; i++)
+    {
+        const char *pcName = Profiler_pcGetLoopableName(psGlobals->ppsLoopables[i]);
+        szLen = Profiler_szAppend(pcOut, szOutMax, szLen, pcName, i, &pasEntries[i]);
+    }
+
+    pasEntries += psGlobals->u16LoopablesMax;
+    for (uint16_t i = 0; i < psGlobals->u16InPinsCount; i++)
+    {
+        const char *pcName = Presentable_pcGetName(&psGlobals->pasInPins[i].sPresentable);
+        szLen = Profiler_szAppend(pcOut, szOutMax, szLen, pcName, 0, &pasEntries[i]);
+    }
+
+    pasEntries += psGlobals->u16InPinsMax;
+    for (uint16_t i = 0; i < psGlobals->u16SwitchesCount; i++)
+    {
+        const char *pcName = Presentable_pcGetName(&psGlobals->pasSwitches[i].sPresentable);
+        szLen = Profiler_szAppend(pcOut, szOutMax, szLen, pcName, 0, &pasEntries[i]);
+    }
+
+    return szLen;
+#else
+    return 0;
+#endif
+}
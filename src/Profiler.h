@@ -0,0 +1,33 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "Types.h"
+
+// Per component loop profile: every vLoop of PinCfgCsv_vLoop() is timed in DWT cycles on STM32, in micros
+// elsewhere. Entries follow the loop order - loopables, inputs, switches - and are read and cleared by the CLI
+// command GET_PROFILE.
+
+typedef struct PROFILER_ENTRY_S
+{
+    uint32_t u32Count;
+    uint32_t u32Total; // saturating
+    uint32_t u32Max;
+} PROFILER_ENTRY_T;
+
+// entries for the counted items, allocated with the item arrays
+size_t Profiler_szGetEntriesCount(uint16_t u16Loopables, uint16_t u16InPins, uint16_t u16Switches);
+
+// starts the cycle counter where there is one
+void Profiler_vInit(void);
+
+// PinCfgCsv_vLoop() component part, each vLoop measured
+void Profiler_vLoopAll(uint32_t u32ms);
+
+// size of the GET_PROFILE text for the current config
+size_t Profiler_szGetTextSize(void);
+
+// "U:<unit>/<name>,<count>,<total>,<max>/..." into pcOut and clears the entries, returns the length.
+// Loopables without a presentable (composite triggers with hold time) are named #<loop index>.
+size_t Profiler_szReadAndReset(char *pcOut, size_t szOutMax);
+
+#endif // PROFILER_H
@@ -23,7 +23,7 @@ static const char *Sensor_pcGetDefaultUnit(MEASUREMENT_TYPE_T eType);
 
 SENSOR_RESULT_T Sensor_eInit(
     SENSOR_T *psHandle,
-    uint8_t *pu8PresentablesCount,
+    uint16_t *pu16PresentablesCount,
     bool bCumulative,
     bool bEnableable,
     STRING_POINT_T *sName,
@@ -46,9 +46,9 @@ SENSOR_RESULT_T Sensor_eInit(
         return SENSOR_NULLPTR_ERROR_E;
 
     // Initialize presentable
-    if (Presentable_eInit(&psHandle->sPresentable, sName, *pu8PresentablesCount) != PRESENTABLE_OK_E)
+    if (Presentable_eInit(&psHandle->sPresentable, sName, *pu16PresentablesCount) != PRESENTABLE_OK_E)
         return SENSOR_SUBINIT_ERROR_E;
-    (*pu8PresentablesCount)++;
+    (*pu16PresentablesCount)++;
 
     // Setup vtab
     psHandle->psSensorMeasure = psSensorMeasure;
@@ -105,7 +105,7 @@ SENSOR_RESULT_T Sensor_eInit(
     // Allocate and store unit string (can be NULL)
     if (psUnit != NULL && psUnit->szLen > 0)
     {
-        char *pcUnitBuf = (char *)Memory_vpAlloc(psUnit->szLen + 1);
+        char *pcUnitBuf = Memory_pcNameAlloc(psUnit->szLen);
         if (pcUnitBuf == NULL)
             return SENSOR_MEMORY_ALLOCATION_ERROR_E;
         memcpy(pcUnitBuf, psUnit->pcStrStart, psUnit->szLen);
@@ -140,9 +140,9 @@ SENSOR_RESULT_T Sensor_eInit(
             return SENSOR_MEMORY_ALLOCATION_ERROR_E;
 
         // Enableable switch gets current count as ID (one more than main sensor)
-        if (Enableable_eInit(psHandle->psEnableable, sName, *pu8PresentablesCount) != ENABLEABLE_OK_E)
+        if (Enableable_eInit(psHandle->psEnableable, sName, *pu16PresentablesCount) != ENABLEABLE_OK_E)
             return SENSOR_SUBINIT_ERROR_E;
-        (*pu8PresentablesCount)++; // Increment for next presentable
+        (*pu16PresentablesCount)++; // Increment for next presentable
     }
     else
     {
@@ -429,7 +429,7 @@ static void Sensor_vSendUnitPrefix(SENSOR_T *psHandle)
         return;
 
     MyMessage msg;
-    if (eMyMessageInit(&msg, psHandle->sPresentable.u8Id, V_UNIT_PREFIX, P_STRING, pcUnit) != WRAP_OK_E)
+    if (eMyMessageInit(&msg, psHandle->sPresentable.u16Id, V_UNIT_PREFIX, P_STRING, pcUnit) != WRAP_OK_E)
         return;
 
     eSend(&msg, false);
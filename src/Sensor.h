@@ -68,7 +68,7 @@ typedef struct SENSOR_S
 
 SENSOR_RESULT_T Sensor_eInit(
     SENSOR_T *psHandle,
-    uint8_t *pu8PresentablesCount,
+    uint16_t *pu16PresentablesCount,
     bool bCumulative,
     bool bEnableable,
     STRING_POINT_T *sName,
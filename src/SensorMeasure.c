@@ -25,7 +25,7 @@ SENSORMEASURE_RESULT_T SensorMeasure_eInit(ISENSORMEASURE_T *psHandle, STRING_PO
         return SENSORMEASURE_NULLPTR_ERROR_E;
 
     // Allocate memory for name string
-    char *pcName = (char *)Memory_vpAlloc(psName->szLen + 1);
+    char *pcName = Memory_pcNameAlloc(psName->szLen);
     if (pcName == NULL)
     {
         return SENSORMEASURE_ALLOCATION_ERROR_E;
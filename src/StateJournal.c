@@ -0,0 +1,99 @@
+#include "StateJournal.h"
+
+#include <string.h>
+
+#include "Globals.h"
+#include "MySensorsWrapper.h"
+#include "PersistentConfiguration.h"
+#include "PinCfgUtils.h"
+
+#if PINCFG_STATE_JOURNAL_D
+// one bit per persisted presentable in presentables order, returns used bytes
+// presentables beyond the journal capacity are not persisted
+static uint8_t StateJournal_u8Collect(uint8_t *pu8State)
+{
+    uint16_t u16Count = 0;
+
+    memset(pu8State, 0, PERCFG_STATE_MAX_SZ);
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+    {
+        PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[i];
+        if (!(psCurrent->u8Flags & PRESENTABLE_FLAG_PERSIST))
+            continue;
+
+        if (u16Count >= PERCFG_STATE_MAX_SZ * 8U)
+            break;
+
+        if (psCurrent->u8State)
+            pu8State[u16Count >> 3] |= (uint8_t)(1U << (u16Count & 7U));
+        u16Count++;
+    }
+
+    return (uint8_t)((u16Count + 7U) / 8U);
+}
+#endif
+
+void StateJournal_vInit(void)
+{
+    psGlobals->bStateJournalDirty = false;
+    psGlobals->u32StateJournalDirtyMs = 0U;
+}
+
+void StateJournal_vRestore(void)
+{
+#if PINCFG_STATE_JOURNAL_D
+    uint8_t au8State[PERCFG_STATE_MAX_SZ];
+    uint8_t u8Size = StateJournal_u8Collect(au8State);
+
+    if (u8Size == 0U || PersistentCfg_eReadState(au8State, u8Size) != PERCFG_OK_E)
+        return;
+
+    uint16_t u16Count = 0;
+    for (uint16_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+    {
+        PRESENTABLE_T *psCurrent = psGlobals->ppsPresentables[i];
+        if (!(psCurrent->u8Flags & PRESENTABLE_FLAG_PERSIST))
+            continue;
+
+        if (u16Count >= PERCFG_STATE_MAX_SZ * 8U)
+            break;
+
+        // sets STATE_CHANGED, switches drive their outputs in the first loop
+        Presentable_vSetState(psCurrent, (au8State[u16Count >> 3] >> (u16Count & 7U)) & 1U, false);
+        u16Count++;
+    }
+
+    // restored states are what the journal already holds
+    psGlobals->bStateJournalDirty = false;
+#endif
+}
+
+void StateJournal_vMarkDirty(void)
+{
+#if PINCFG_STATE_JOURNAL_D
+    if (psGlobals->bStateJournalDirty)
+        return;
+
+    psGlobals->bStateJournalDirty = true;
+    psGlobals->u32StateJournalDirtyMs = u32Millis();
+#endif
+}
+
+void StateJournal_vLoop(uint32_t u32ms)
+{
+#if PINCFG_STATE_JOURNAL_D
+    if (!psGlobals->bStateJournalDirty ||
+        PinCfg_u32GetElapsedTime(psGlobals->u32StateJournalDirtyMs, u32ms) < PINCFG_STATE_JOURNAL_DELAY_MS_D)
+        return;
+
+    // everything changed since the first change goes in one record
+    psGlobals->bStateJournalDirty = false;
+
+    uint8_t au8State[PERCFG_STATE_MAX_SZ];
+    uint8_t u8Size = StateJournal_u8Collect(au8State);
+    if (u8Size > 0U)
+        PersistentCfg_eWriteState(au8State, u8Size);
+#else
+    (void)u32ms;
+#endif
+}
@@ -0,0 +1,20 @@
+#ifndef STATEJOURNAL_H
+#define STATEJOURNAL_H
+
+#include "Types.h"
+
+// Keeps the states of presentables flagged PRESENTABLE_FLAG_PERSIST (classic switches, enableables) in the
+// EEPROM state journal, so they come back after reset without asking the controller.
+
+// clears pending changes, called with memory init
+void StateJournal_vInit(void);
+
+// applies the newest journal record to the parsed presentables, called before the first loop
+void StateJournal_vRestore(void);
+
+// a persisted state changed, it will be written within PINCFG_STATE_JOURNAL_DELAY_MS_D
+void StateJournal_vMarkDirty(void);
+
+void StateJournal_vLoop(uint32_t u32ms);
+
+#endif // STATEJOURNAL_H
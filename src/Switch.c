@@ -42,7 +42,7 @@ void Switch_vInitType(PRESENTABLE_VTAB_T *psVtab)
 SWITCH_RESULT_T Switch_eInit(
     SWITCH_T *psHandle,
     STRING_POINT_T *sName,
-    uint8_t u8Id,
+    uint16_t u16Id,
     SWITCH_MODE_T eMode,
     uint8_t u8OutPin,
     uint8_t u8FbPin,
@@ -51,7 +51,34 @@ SWITCH_RESULT_T Switch_eInit(
     if (psHandle == NULL)
         return SWITCH_NULLPTR_ERROR_E;
 
-    if (Presentable_eInit(&psHandle->sPresentable, sName, u8Id) != PRESENTABLE_OK_E)
+    if (Presentable_eInit(&psHandle->sPresentable, sName, u16Id) != PRESENTABLE_OK_E)
+    {
+        return SWITCH_SUBINIT_ERROR_E;
+    }
+
+    return Switch_eInitReuseName(
+        psHandle,
+        psHandle->sPresentable.pcName,
+        u16Id,
+        eMode,
+        u8OutPin,
+        u8FbPin,
+        u32TimedAdidtionalDelayMs);
+}
+
+SWITCH_RESULT_T Switch_eInitReuseName(
+    SWITCH_T *psHandle,
+    const char *pcName,
+    uint16_t u16Id,
+    SWITCH_MODE_T eMode,
+    uint8_t u8OutPin,
+    uint8_t u8FbPin,
+    uint32_t u32TimedAdidtionalDelayMs)
+{
+    if (psHandle == NULL)
+        return SWITCH_NULLPTR_ERROR_E;
+
+    if (Presentable_eInitReuseName(&psHandle->sPresentable, pcName, u16Id) != PRESENTABLE_OK_E)
     {
         return SWITCH_SUBINIT_ERROR_E;
     }
@@ -88,6 +115,10 @@ SWITCH_RESULT_T Switch_eInit(
         break;
     }
 
+    // impulse and timed outputs must not fire again after reset
+    if (eMode == SWITCH_CLASSIC_E)
+        psHandle->sPresentable.u8Flags |= PRESENTABLE_FLAG_PERSIST;
+
     psHandle->eMode = eMode;
     psHandle->u8OutPin = u8OutPin;
     psHandle->u8FbPin = u8FbPin;
@@ -256,6 +287,31 @@ void Switch_vLoopTimedFeedback(LOOPABLE_T *psLoopableHandle, uint32_t u32ms)
     }
 }
 
+void Switch_vLoopAll(SWITCH_T *pasSwitches, uint16_t u16Count, uint32_t u32ms)
+{
+    for (uint16_t i = 0; i < u16Count; i++)
+    {
+        SWITCH_T *psHandle = &pasSwitches[i];
+
+        if (psHandle->u8FbPin > 0)
+            Switch_vCheckFbPin(psHandle, u32ms);
+
+        // timed switches must turn off even without state change, the others only act on one
+        if (psHandle->eMode == SWITCH_TIMED_E)
+        {
+            if (psHandle->u32ImpulseDuration > 0U)
+                Switch_vHandleTimed(psHandle, u32ms);
+        }
+        else if (psHandle->sPresentable.u8Flags & PRESENTABLE_FLAG_STATE_CHANGED)
+        {
+            if (psHandle->eMode == SWITCH_CLASSIC_E)
+                Switch_vHandleClassic(psHandle);
+            else
+                Switch_vHandleImpulse(psHandle, u32ms);
+        }
+    }
+}
+
 void Switch_vEventHandle(SWITCH_T *psHandle, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms)
 {
     if (psHandle == NULL)
@@ -46,11 +46,23 @@ void Switch_vInitType(PRESENTABLE_VTAB_T *psVtab);
 SWITCH_RESULT_T Switch_eInit(
     SWITCH_T *psHandle,
     STRING_POINT_T *sName,
-    uint8_t u8Id,
+    uint16_t u16Id,
     SWITCH_MODE_T eMode,
     uint8_t u8OutPin,
     uint8_t u8FbPin,
     uint32_t u32TimedAdidtionalDelayMs);
+// pcName is not copied, it must outlive the switch
+SWITCH_RESULT_T Switch_eInitReuseName(
+    SWITCH_T *psHandle,
+    const char *pcName,
+    uint16_t u16Id,
+    SWITCH_MODE_T eMode,
+    uint8_t u8OutPin,
+    uint8_t u8FbPin,
+    uint32_t u32TimedAdidtionalDelayMs);
+
+// loops all switches of a contiguous array, equal to calling sLoopable.vLoop of each
+void Switch_vLoopAll(SWITCH_T *pasSwitches, uint16_t u16Count, uint32_t u32ms);
 
 // forwarded event handler
 void Switch_vEventHandle(SWITCH_T *psHandle, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms);
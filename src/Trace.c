@@ -0,0 +1,114 @@
+#include "Trace.h"
+
+#include <stdio.h>
+
+#include "Globals.h"
+
+#if PINCFG_TRACE_D
+static TRACE_ENTRY_T *Trace_psNext(void)
+{
+    TRACE_ENTRY_T *psEntry = &psGlobals->asTrace[psGlobals->u16TraceHead];
+    psGlobals->u16TraceHead = (uint16_t)((psGlobals->u16TraceHead + 1U) & (PINCFG_TRACE_SIZE_D - 1U));
+    if (psGlobals->u16TraceCount < PINCFG_TRACE_SIZE_D)
+        psGlobals->u16TraceCount++;
+
+    return psEntry;
+}
+#endif
+
+void Trace_vInit(void)
+{
+#if PINCFG_TRACE_D
+    psGlobals->u16TraceHead = 0U;
+    psGlobals->u16TraceCount = 0U;
+    psGlobals->u16TracePublisherId = 0U;
+#endif
+}
+
+void Trace_vEvent(uint16_t u16PublisherId, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms)
+{
+#if PINCFG_TRACE_D
+    TRACE_ENTRY_T *psEntry = Trace_psNext();
+    psEntry->u32Ms = u32ms;
+    psEntry->i32Data = i32Data;
+    psEntry->u16PublisherId = u16PublisherId;
+    psEntry->u16TriggerId = TRACE_NO_TRIGGER;
+    psEntry->u8EventType = u8EventType;
+    psEntry->u8Action = TRACE_NO_ACTION;
+    psGlobals->u16TracePublisherId = u16PublisherId;
+#else
+    (void)u16PublisherId;
+    (void)u8EventType;
+    (void)i32Data;
+    (void)u32ms;
+#endif
+}
+
+void Trace_vTrigger(uint16_t u16TriggerId, uint8_t u8Action, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms)
+{
+#if PINCFG_TRACE_D
+    TRACE_ENTRY_T *psEntry = Trace_psNext();
+    psEntry->u32Ms = u32ms;
+    psEntry->i32Data = i32Data;
+    psEntry->u16PublisherId = psGlobals->u16TracePublisherId;
+    psEntry->u16TriggerId = u16TriggerId;
+    psEntry->u8EventType = u8EventType;
+    psEntry->u8Action = u8Action;
+#else
+    (void)u16TriggerId;
+    (void)u8Action;
+    (void)u8EventType;
+    (void)i32Data;
+    (void)u32ms;
+#endif
+}
+
+size_t Trace_szRead(char *pcOut, size_t szOutMax)
+{
+    if (pcOut == NULL || szOutMax == 0)
+        return 0;
+
+    pcOut[0] = '\0';
+#if PINCFG_TRACE_D
+    size_t szLen = 0;
+    // oldest entry, the ring size is a power of two
+    uint16_t u16Idx = (uint16_t)((psGlobals->u16TraceHead + PINCFG_TRACE_SIZE_D - psGlobals->u16TraceCount) &
+                                 (PINCFG_TRACE_SIZE_D - 1U));
+    for (uint16_t i = 0; i < psGlobals->u16TraceCount; i++)
+    {
+        const TRACE_ENTRY_T *psEntry = &psGlobals->asTrace[u16Idx];
+        int iLen = snprintf(
+            &pcOut[szLen],
+            szOutMax - szLen,
+            "%lu,%u,%u,%ld",
+            (unsigned long)psEntry->u32Ms,
+            (unsigned)psEntry->u16PublisherId,
+            (unsigned)psEntry->u8EventType,
+            (long)psEntry->i32Data);
+        if (iLen > 0 && (size_t)iLen < szOutMax - szLen && psEntry->u16TriggerId != TRACE_NO_TRIGGER)
+        {
+            iLen += snprintf(
+                &pcOut[szLen + (size_t)iLen],
+                szOutMax - szLen - (size_t)iLen,
+                ",%u,%u",
+                (unsigned)psEntry->u16TriggerId,
+                (unsigned)psEntry->u8Action);
+        }
+        if (iLen < 0 || (size_t)iLen + 1U >= szOutMax - szLen)
+        {
+            // entry does not fit, drop it whole
+            pcOut[szLen] = '\0';
+            break;
+        }
+
+        szLen += (size_t)iLen;
+        pcOut[szLen++] = '/';
+        pcOut[szLen] = '\0';
+        u16Idx = (uint16_t)((u16Idx + 1U) & (PINCFG_TRACE_SIZE_D - 1U));
+    }
+
+    return szLen;
+#else
+    return 0;
+#endif
+}
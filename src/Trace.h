@@ -0,0 +1,37 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Types.h"
+
+// Flight recorder of events and the triggers they fired, the last PINCFG_TRACE_SIZE_D entries are kept and
+// dumped by the CLI command GET_TRACE.
+
+#define TRACE_NO_TRIGGER 0xFFFFU // event entry, no trigger fired
+#define TRACE_NO_ACTION 0xFFU
+
+typedef struct TRACE_ENTRY_S
+{
+    uint32_t u32Ms;
+    int32_t i32Data;
+    uint16_t u16PublisherId; // presentable id of the input or sensor that sent the event
+    uint16_t u16TriggerId;   // config line of the fired trigger, TRACE_NO_TRIGGER for the event itself
+    uint8_t u8EventType;     // TRIGGER_EVENTTYPE_T
+    uint8_t u8Action;        // TRIGGER_ACTION_T of the trigger's first switch, TRACE_NO_ACTION for the event
+} TRACE_ENTRY_T;
+
+// "<ms>,<publisher>,<event>,<data>[,<trigger>,<action>]/" per entry
+#define TRACE_TEXT_MAX_SZ (PINCFG_TRACE_SIZE_D * 48U + 1U)
+
+// empties the ring, called with memory init
+void Trace_vInit(void);
+
+// an event sent by a publisher, remembered as the source of the trigger entries that follow
+void Trace_vEvent(uint16_t u16PublisherId, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms);
+
+// a trigger fired by the last traced event
+void Trace_vTrigger(uint16_t u16TriggerId, uint8_t u8Action, uint8_t u8EventType, int32_t i32Data, uint32_t u32ms);
+
+// formats the ring oldest first into pcOut (TRACE_TEXT_MAX_SZ fits all), returns the length. The ring is kept.
+size_t Trace_szRead(char *pcOut, size_t szOutMax);
+
+#endif // TRACE_H
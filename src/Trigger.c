@@ -2,6 +2,7 @@
 
 #include "Globals.h"
 #include "Switch.h"
+#include "Trace.h"
 
 static void Trigger_vEventHandle(
     IEVENTSUBSCRIBER_T *psBaseHandle,
@@ -28,6 +29,7 @@ TRIGGER_RESULT_T Trigger_eInit(
     // parameters init
     psHandle->pasSwAct = pasSwAct;
     psHandle->u8SwActCount = u8SwActCount;
+    psHandle->u16Line = TRACE_NO_TRIGGER;
     psHandle->eEventType = eEventType;
     psHandle->i32EventData = i32EventData;
 
@@ -55,10 +57,21 @@ static void Trigger_vEventHandle(IEVENTSUBSCRIBER_T *psBaseHandle, uint8_t u8Eve
     if (psHandle->eEventType == TRIGGER_MULTI_E && i32Data != psHandle->i32EventData)
         return;
 
-    for (uint8_t i = 0; i < psHandle->u8SwActCount; i++)
+    Trace_vTrigger(psHandle->u16Line, (uint8_t)psHandle->pasSwAct[0].eAction, u8EventType, i32Data, u32ms);
+    Trigger_vDriveSwitches(psHandle->pasSwAct, psHandle->u8SwActCount, u8EventType, i32Data, u32ms);
+}
+
+void Trigger_vDriveSwitches(
+    TRIGGER_SWITCHACTION_T *pasSwAct,
+    uint8_t u8SwActCount,
+    uint8_t u8EventType,
+    int32_t i32Data,
+    uint32_t u32ms)
+{
+    for (uint8_t i = 0; i < u8SwActCount; i++)
     {
-        PRESENTABLE_T *psMyPresentHnd = (PRESENTABLE_T *)psHandle->pasSwAct[i].psSwitchHnd;
-        switch (psHandle->pasSwAct[i].eAction)
+        PRESENTABLE_T *psMyPresentHnd = (PRESENTABLE_T *)pasSwAct[i].psSwitchHnd;
+        switch (pasSwAct[i].eAction)
         {
         case TRIGGER_A_TOGGLE_E: Presentable_vToggle(psMyPresentHnd); break;
         case TRIGGER_A_UP_E: Presentable_vSetState(psMyPresentHnd, (int32_t) true, true); break;
@@ -45,6 +45,7 @@ typedef struct TRIGGER_S
     IEVENTSUBSCRIBER_T sEventSubscriber;
     TRIGGER_SWITCHACTION_T *pasSwAct;
     uint8_t u8SwActCount;
+    uint16_t u16Line; // config line, identifies the trigger in the event trace
     TRIGGER_EVENTTYPE_T eEventType;
     int32_t i32EventData;
 } TRIGGER_T;
@@ -56,4 +57,12 @@ TRIGGER_RESULT_T Trigger_eInit(
     TRIGGER_EVENTTYPE_T eEventType,
     int32_t i32EventData);
 
+// shared by all trigger kinds
+void Trigger_vDriveSwitches(
+    TRIGGER_SWITCHACTION_T *pasSwAct,
+    uint8_t u8SwActCount,
+    uint8_t u8EventType,
+    int32_t i32Data,
+    uint32_t u32ms);
+
 #endif // TRIGGER_H
\ No newline at end of file
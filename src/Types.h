@@ -36,11 +36,91 @@
 #endif
 #define PINCFG_AUTH_HEX_PASSWORD_LEN_D 64
 
-// Config data section size
+// Config data section size (as stored in EEPROM, compressed when PINCFG_CONFIG_COMPRESS_D)
 #ifndef PINCFG_CONFIG_MAX_SZ_D
 #define PINCFG_CONFIG_MAX_SZ_D 480
 #endif
 
+// Config text size accepted by the CLI (receive buffer). With compression enabled it can be set above
+// PINCFG_CONFIG_MAX_SZ_D, typical configs compress 2-3x.
+#ifndef PINCFG_CONFIG_TEXT_MAX_SZ_D
+#define PINCFG_CONFIG_TEXT_MAX_SZ_D PINCFG_CONFIG_MAX_SZ_D
+#endif
+
+// Compress config on save (configs stored compressed are always readable)
+#ifndef PINCFG_CONFIG_COMPRESS_D
+#define PINCFG_CONFIG_COMPRESS_D 1
+#endif
+
+// CRC implementation of the persistent configuration (stored values are the same for all of them):
+// 0 - bit by bit (smallest), 1 - nibble tables (48 B flash), 2 - byte tables (768 B flash),
+// 3 - STM32 hardware CRC unit (parts with programmable polynomial only)
+#ifndef PINCFG_CRC_MODE_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_CRC_MODE_D 0
+#else
+#define PINCFG_CRC_MODE_D 2
+#endif
+#endif
+#if PINCFG_CRC_MODE_D < 0 || PINCFG_CRC_MODE_D > 3
+#error "PINCFG_CRC_MODE_D must be 0 (bitwise), 1 (nibble table), 2 (byte table) or 3 (STM32 hardware)."
+#endif
+
+// Journal of classic switch and enableable states, restored on boot (0 disables)
+#ifndef PINCFG_STATE_JOURNAL_D
+#define PINCFG_STATE_JOURNAL_D 1
+#endif
+
+// EEPROM kept free of config backup for the journal, it also uses whatever the backup leaves free
+#ifndef PINCFG_STATE_JOURNAL_MIN_SZ_D
+#define PINCFG_STATE_JOURNAL_MIN_SZ_D 32
+#endif
+
+// State changes are coalesced, at most one journal write per this period
+#ifndef PINCFG_STATE_JOURNAL_DELAY_MS_D
+#define PINCFG_STATE_JOURNAL_DELAY_MS_D 5000
+#endif
+
+// Uploaded config replaces the running one in place, 0 restarts the node with resetFunc() instead
+#ifndef PINCFG_HOT_RELOAD_D
+#define PINCFG_HOT_RELOAD_D 1
+#endif
+
+// Component names are packed back to back into chunks of this size instead of one aligned allocation
+// each (0 disables, names longer than a chunk always get their own allocation). AVR pads to 2 bytes only,
+// there the chunk tails would cost more than they save.
+#ifndef PINCFG_NAME_CHUNK_SZ_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_NAME_CHUNK_SZ_D 0
+#else
+#define PINCFG_NAME_CHUNK_SZ_D 64
+#endif
+#endif
+#if (PINCFG_NAME_CHUNK_SZ_D > 255)
+#error PINCFG_NAME_CHUNK_SZ_D is more then 255!
+#endif
+
+// The active pinCfg instance (see PinCfgCsv_eInitCtx) is kept per thread on hosted builds, so threads can run
+// their own instances. Microcontroller builds have a single thread and no TLS support.
+#ifndef PINCFG_THREAD_LOCAL
+#if !(defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define PINCFG_THREAD_LOCAL
+#elif defined(__cplusplus)
+#define PINCFG_THREAD_LOCAL thread_local
+#else
+#define PINCFG_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+// MySensors child ids are 8-bit and 255 addresses the node itself. Presentables are numbered from 0 (the CLI),
+// the parser rejects configs that need more child ids than this.
+#ifndef PINCFG_CHILD_IDS_MAX_D
+#define PINCFG_CHILD_IDS_MAX_D 255
+#endif
+#if (PINCFG_CHILD_IDS_MAX_D < 1 || PINCFG_CHILD_IDS_MAX_D > 255)
+#error PINCFG_CHILD_IDS_MAX_D must be in range 1..255!
+#endif
+
 #ifndef PINCFG_TXTSTATE_MAX_SZ_D
 #define PINCFG_TXTSTATE_MAX_SZ_D 25
 #endif
@@ -52,6 +132,13 @@
 #error PINCFG_TRIGGER_MAX_SWITCHES_D is more then 255!
 #endif
 
+#ifndef PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D
+#define PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D 8
+#endif
+#if (PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D > 8)
+#error PINCFG_COMPOSITE_TRIGGER_MAX_CONDITIONS_D is more then 8!
+#endif
+
 #ifndef PINCFG_DEBOUNCE_MS_D
 #define PINCFG_DEBOUNCE_MS_D 100
 #endif
@@ -72,6 +159,32 @@
 #define PINCFG_LONG_MESSAGE_DELAY_MS_D 50
 #endif
 
+// Outgoing state message queue (0 = send immediately, no rate limiting). A MyMessage takes 32 B, AVR keeps 2 of them.
+#ifndef PINCFG_SEND_QUEUE_SZ_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_SEND_QUEUE_SZ_D 2
+#else
+#define PINCFG_SEND_QUEUE_SZ_D 8
+#endif
+#endif
+#if (PINCFG_SEND_QUEUE_SZ_D > 255)
+#error PINCFG_SEND_QUEUE_SZ_D is more then 255!
+#endif
+
+// Token bucket: up to BURST messages back to back, then one per INTERVAL
+#ifndef PINCFG_SEND_QUEUE_BURST_D
+#define PINCFG_SEND_QUEUE_BURST_D 3
+#endif
+
+#ifndef PINCFG_SEND_QUEUE_INTERVAL_MS_D
+#define PINCFG_SEND_QUEUE_INTERVAL_MS_D 25
+#endif
+
+// Pause between two presented items (and initial states with MY_CONTROLLER_HA)
+#ifndef PINCFG_PRESENTATION_INTERVAL_MS_D
+#define PINCFG_PRESENTATION_INTERVAL_MS_D 50
+#endif
+
 #ifndef PINCFG_LINE_SEPARATOR_D
 #define PINCFG_LINE_SEPARATOR_D '/'
 #endif
@@ -148,4 +261,72 @@
 #define PINCFG_CLI_RECEIVE_TIMEOUT_MS_D 60000 /* 60 seconds */
 #endif
 
+// Sequenced CLI upload: fragments in flight before the sender waits for ACK/NAK (power of 2, max 8)
+#ifndef PINCFG_CLI_SEQ_WINDOW_D
+#define PINCFG_CLI_SEQ_WINDOW_D 8
+#endif
+
+#if PINCFG_CLI_SEQ_WINDOW_D == 0 || PINCFG_CLI_SEQ_WINDOW_D > 8 ||                                                   \
+    (PINCFG_CLI_SEQ_WINDOW_D & (PINCFG_CLI_SEQ_WINDOW_D - 1)) != 0
+#error "PINCFG_CLI_SEQ_WINDOW_D must be 1, 2, 4 or 8"
+#endif
+
+// Silence after the last sequenced fragment before the node reports ACK/NAK on its own
+#ifndef PINCFG_CLI_SEQ_ACK_DELAY_MS_D
+#define PINCFG_CLI_SEQ_ACK_DELAY_MS_D 200
+#endif
+
+// Histogram of PinCfgCsv_vLoop() durations read by the CLI command GET_LOOPSTATS (0 disables). Off on AVR, where the
+// counters and the micros() calls around every loop are not worth it.
+#ifndef PINCFG_LOOPSTATS_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_LOOPSTATS_D 0
+#else
+#define PINCFG_LOOPSTATS_D 1
+#endif
+#endif
+
+// log2 buckets of micros, the last one takes everything from 2^(n-2) us up
+#ifndef PINCFG_LOOPSTATS_BUCKETS_D
+#define PINCFG_LOOPSTATS_BUCKETS_D 20
+#endif
+
+#if PINCFG_LOOPSTATS_BUCKETS_D < 2 || PINCFG_LOOPSTATS_BUCKETS_D > 32
+#error "PINCFG_LOOPSTATS_BUCKETS_D must be in range 2..32"
+#endif
+
+// Times every component's vLoop in PinCfgCsv_vLoop(), read by the CLI command GET_PROFILE (1 enables)
+#ifndef PINCFG_PROFILER_D
+#define PINCFG_PROFILER_D 0
+#endif
+
+// Ring of the last events and fired triggers dumped by the CLI command GET_TRACE (0 disables). Off on AVR, the ring
+// takes a tenth of the SRAM of an ATmega328.
+#ifndef PINCFG_TRACE_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_TRACE_D 0
+#else
+#define PINCFG_TRACE_D 1
+#endif
+#endif
+
+// entries kept, 16 bytes each
+#ifndef PINCFG_TRACE_SIZE_D
+#define PINCFG_TRACE_SIZE_D 16
+#endif
+
+#if PINCFG_TRACE_SIZE_D < 2 || PINCFG_TRACE_SIZE_D > 1024 || (PINCFG_TRACE_SIZE_D & (PINCFG_TRACE_SIZE_D - 1)) != 0
+#error "PINCFG_TRACE_SIZE_D must be a power of two in range 2..1024"
+#endif
+
+// Arena usage per component type and the temp high-water mark read by the CLI command GET_MEM (0 disables). Off on
+// AVR, size the arena there with a host build of the same config.
+#ifndef PINCFG_MEMSTATS_D
+#if defined(ARDUINO_ARCH_AVR)
+#define PINCFG_MEMSTATS_D 0
+#else
+#define PINCFG_MEMSTATS_D 1
+#endif
+#endif
+
 #endif // TYPES_H
@@ -0,0 +1,66 @@
+/**
+ * CRC throughput of the PersistentConfiguration implementation selected by PINCFG_CRC_MODE_D.
+ * Built once per mode: `make bench` (host) and `make bench` in qemu_test (Cortex-M3 under QEMU).
+ * One round is what a config load checks: CRC16 over password + max config and CRC8 per 32 B block.
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "PersistentConfiguration.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS 20000UL
+#endif
+
+#define BENCH_DATA_SZ (PINCFG_AUTH_PASSWORD_LEN_D + PINCFG_CONFIG_MAX_SZ_D)
+#define BENCH_BLOCK_SZ 32U
+
+// EEPROM image the mocks work on (normally provided by test_helpers.c)
+uint8_t mock_EEPROM[1024];
+
+static const char *const _apcModeNames[] = {"bitwise", "nibble", "byte table", "stm32 hw"};
+
+// nanoseconds per round
+static unsigned long u32NsPerRound(clock_t tTicks)
+{
+    return (unsigned long)(((unsigned long long)tTicks * 1000000000ULL) / CLOCKS_PER_SEC / BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    static uint8_t au8Data[BENCH_DATA_SZ];
+    volatile uint16_t u16Sink = 0;
+    volatile uint8_t u8Sink = 0;
+
+    for (uint16_t i = 0; i < BENCH_DATA_SZ; i++)
+        au8Data[i] = (uint8_t)(i * 37U + 11U);
+
+    clock_t tStart = clock();
+    for (unsigned long r = 0; r < BENCH_ROUNDS; r++)
+        u16Sink ^= crc16(au8Data, BENCH_DATA_SZ);
+    clock_t tCrc16 = clock() - tStart;
+
+    tStart = clock();
+    for (unsigned long r = 0; r < BENCH_ROUNDS; r++)
+    {
+        for (uint16_t u16Off = 0; u16Off < BENCH_DATA_SZ; u16Off += BENCH_BLOCK_SZ)
+        {
+            uint16_t u16Sz = (u16Off + BENCH_BLOCK_SZ <= BENCH_DATA_SZ) ? BENCH_BLOCK_SZ : (uint16_t)(BENCH_DATA_SZ - u16Off);
+            u8Sink ^= crc8(&au8Data[u16Off], u16Sz);
+        }
+    }
+    clock_t tCrc8 = clock() - tStart;
+
+    printf(
+        "crc mode %d (%-10s) %u B x %lu: crc16 %lu ns, crc8 %lu ns per round (%04X %02X)\n",
+        PINCFG_CRC_MODE_D,
+        _apcModeNames[PINCFG_CRC_MODE_D],
+        (unsigned)BENCH_DATA_SZ,
+        (unsigned long)BENCH_ROUNDS,
+        u32NsPerRound(tCrc16),
+        u32NsPerRound(tCrc8),
+        crc16(au8Data, BENCH_DATA_SZ),
+        crc8(au8Data, BENCH_DATA_SZ));
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * Main loop cost with 1000 components: 150 switches, 100 inputs and 750 triggers, one per config line (the
+ * presentables stay within the MySensors child ids).
+ * Built by `make bench`. Also compares the typed switch array against calling every switch through its
+ * loopable interface.
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "Globals.h"
+#include "Memory.h"
+#include "PinCfgCsv.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS 200000UL
+#endif
+
+#define BENCH_SWITCHES 150
+#define BENCH_INPINS 100
+#define BENCH_TRIGGERS 750
+#define BENCH_COMPONENTS (BENCH_SWITCHES + BENCH_INPINS + BENCH_TRIGGERS)
+
+// EEPROM image the mocks work on (normally provided by test_helpers.c)
+uint8_t mock_EEPROM[1024];
+
+static uint8_t _au8Memory[1024 * 1024];
+static char _acCfg[BENCH_COMPONENTS * 24];
+
+// nanoseconds per round
+static unsigned long u32NsPerRound(clock_t tTicks)
+{
+    return (unsigned long)(((unsigned long long)tTicks * 1000000000ULL) / CLOCKS_PER_SEC / BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    char acOutStr[128];
+    size_t szLen = 0;
+
+    for (int i = 0; i < BENCH_SWITCHES; i++)
+        szLen += (size_t)sprintf(&_acCfg[szLen], "S,o%d,%d/", i, 1 + i % 30);
+    for (int i = 0; i < BENCH_INPINS; i++)
+        szLen += (size_t)sprintf(&_acCfg[szLen], "I,i%d,%d/", i, 1 + i % 30);
+    for (int i = 0; i < BENCH_TRIGGERS; i++)
+        szLen += (size_t)sprintf(&_acCfg[szLen], "T,t%d,i%d,0,1,o%d,2/", i, i % BENCH_INPINS, i % BENCH_SWITCHES);
+
+    PINCFG_PARSE_PARAMS_T sParams = {
+        .pcConfig = _acCfg,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
+        .pszMemoryRequired = NULL,
+        .pcOutString = acOutStr,
+        .u16OutStrMaxLen = (uint16_t)sizeof(acOutStr),
+        .bValidate = false};
+
+    if (Memory_eInit(_au8Memory, sizeof(_au8Memory)) != MEMORY_OK_E || PinCfgCsv_eParse(&sParams) != PINCFG_OK_E)
+    {
+        printf("bench loop: config not parsed: %s\n", acOutStr);
+        return 1;
+    }
+
+    clock_t tStart = clock();
+    for (unsigned long r = 0; r < BENCH_ROUNDS; r++)
+        PinCfgCsv_vLoop((uint32_t)r);
+    clock_t tLoop = clock() - tStart;
+
+    tStart = clock();
+    for (unsigned long r = 0; r < BENCH_ROUNDS; r++)
+        Switch_vLoopAll(psGlobals->pasSwitches, psGlobals->u16SwitchesCount, (uint32_t)r);
+    clock_t tArray = clock() - tStart;
+
+    tStart = clock();
+    for (unsigned long r = 0; r < BENCH_ROUNDS; r++)
+    {
+        for (uint16_t i = 0; i < psGlobals->u16SwitchesCount; i++)
+        {
+            LOOPABLE_T *psLoopable = &psGlobals->pasSwitches[i].sLoopable;
+            psLoopable->vLoop(psLoopable, (uint32_t)r);
+        }
+    }
+    clock_t tIndirect = clock() - tStart;
+
+    unsigned long u32LoopNs = u32NsPerRound(tLoop);
+    printf(
+        "loop %u components (%u presentables): %lu ns per loop, %.2f ns per component\n",
+        (unsigned)BENCH_COMPONENTS,
+        (unsigned)psGlobals->u16PresentablesCount,
+        u32LoopNs,
+        (double)u32LoopNs / BENCH_COMPONENTS);
+    printf(
+        "loop %u switches: %lu ns typed array, %lu ns through vLoop\n",
+        (unsigned)psGlobals->u16SwitchesCount,
+        u32NsPerRound(tArray),
+        u32NsPerRound(tIndirect));
+
+    return 0;
+}
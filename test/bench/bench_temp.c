@@ -0,0 +1,134 @@
+/**
+ * Temporary allocator under mixed alloc/free patterns on a 4 kB arena, the size of a small board's pinCfg memory.
+ * Built by `make bench`. Reports ns per alloc/free pair and the largest temporary region each pattern needed;
+ * a pattern that leaks runs out of memory and reports the round it failed in.
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "Globals.h"
+#include "Memory.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS 200000UL
+#endif
+
+#define BENCH_ARENA_SZ 4096U
+#define BENCH_SLOTS 8U
+
+// EEPROM image the mocks work on (normally provided by test_helpers.c)
+uint8_t mock_EEPROM[1024];
+
+static uint8_t _au8Memory[BENCH_ARENA_SZ];
+
+typedef enum BENCH_PATTERN_E
+{
+    BENCH_LIFO_E,    // stack order, what the allocator always handled
+    BENCH_FIFO_E,    // oldest first, CLI buffer freed after the reply that followed it
+    BENCH_RANDOM_E,  // random slot, random size
+    BENCH_ROLLING_E, // a long lived block and two alternating buffers, never both free
+    BENCH_PATTERNS_E
+} BENCH_PATTERN_T;
+
+static const char *const _apcPatternNames[BENCH_PATTERNS_E] = {"lifo", "fifo", "random", "rolling"};
+
+static uint32_t _u32Rand = 12345U;
+
+static uint32_t u32Rand(void)
+{
+    _u32Rand = _u32Rand * 1103515245U + 12345U;
+    return _u32Rand >> 16;
+}
+
+// block size for the round, 16 .. 272 bytes
+static size_t szSize(BENCH_PATTERN_T ePattern, unsigned long r)
+{
+    return (ePattern == BENCH_RANDOM_E) ? (size_t)(16U + u32Rand() % 257U) : (size_t)(16U + (r * 37U) % 257U);
+}
+
+// returns the failed round or 0
+static unsigned long u32Run(BENCH_PATTERN_T ePattern, size_t *pszTempMax)
+{
+    void *apvSlots[BENCH_SLOTS] = {NULL};
+    size_t szTempMax = 0;
+    unsigned long u32Failed = 0;
+
+    Memory_eInit(_au8Memory, sizeof(_au8Memory));
+    void *pvLongLived = (ePattern == BENCH_ROLLING_E) ? Memory_vpTempAlloc(64) : NULL;
+
+    for (unsigned long r = 0; r < BENCH_ROUNDS && u32Failed == 0; r++)
+    {
+        uint8_t u8Slot;
+        switch (ePattern)
+        {
+        case BENCH_LIFO_E:
+            // fill all slots, then empty them from the last one
+            u8Slot = (uint8_t)(r % (2U * BENCH_SLOTS));
+            u8Slot = (u8Slot < BENCH_SLOTS) ? u8Slot : (uint8_t)(2U * BENCH_SLOTS - 1U - u8Slot);
+            break;
+        case BENCH_RANDOM_E: u8Slot = (uint8_t)(u32Rand() % BENCH_SLOTS); break;
+        case BENCH_ROLLING_E:
+            // the older of the two buffers is replaced while the newer one is still in use
+            u8Slot = (uint8_t)(r % 2U);
+            Memory_vTempFreePt(apvSlots[u8Slot]);
+            apvSlots[u8Slot] = NULL;
+            break;
+        case BENCH_FIFO_E:
+        default: u8Slot = (uint8_t)(r % BENCH_SLOTS); break;
+        }
+
+        if (apvSlots[u8Slot] != NULL)
+        {
+            Memory_vTempFreePt(apvSlots[u8Slot]);
+            apvSlots[u8Slot] = NULL;
+        }
+        else
+        {
+            apvSlots[u8Slot] = Memory_vpTempAlloc(szSize(ePattern, r));
+            if (apvSlots[u8Slot] == NULL)
+                u32Failed = r + 1;
+        }
+
+        size_t szTemp = (size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd);
+        if (szTemp > szTempMax)
+            szTempMax = szTemp;
+    }
+
+    for (uint8_t i = 0; i < BENCH_SLOTS; i++)
+        Memory_vTempFreePt(apvSlots[i]);
+    Memory_vTempFreePt(pvLongLived);
+    if (u32Failed == 0 && psGlobals->pvMemTempEnd != psGlobals->pvMemEnd)
+        u32Failed = BENCH_ROUNDS; // not everything came back
+
+    *pszTempMax = szTempMax;
+    return u32Failed;
+}
+
+int main(void)
+{
+    int iResult = 0;
+
+    for (uint8_t p = 0; p < BENCH_PATTERNS_E; p++)
+    {
+        size_t szTempMax;
+        clock_t tStart = clock();
+        unsigned long u32Failed = u32Run((BENCH_PATTERN_T)p, &szTempMax);
+        clock_t tRun = clock() - tStart;
+
+        if (u32Failed != 0)
+        {
+            printf("temp %-8s out of memory in round %lu of %lu\n", _apcPatternNames[p], u32Failed, BENCH_ROUNDS);
+            iResult = 1;
+            continue;
+        }
+
+        printf(
+            "temp %-8s %lu ns per alloc/free, largest temp region %lu of %u B\n",
+            _apcPatternNames[p],
+            (unsigned long)(((unsigned long long)tRun * 1000000000ULL) / CLOCKS_PER_SEC / BENCH_ROUNDS),
+            (unsigned long)szTempMax,
+            (unsigned)(BENCH_ARENA_SZ - sizeof(GLOBALS_T)));
+    }
+
+    return iResult;
+}
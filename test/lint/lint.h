@@ -0,0 +1,22 @@
+#ifndef LINT_H
+#define LINT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "Types.h"
+
+#define LINT_EEPROM_SZ_D 1024
+
+    // EEPROM image of the file the calling worker checks, the hardware layer works on it
+    extern PINCFG_THREAD_LOCAL uint8_t *pu8LintEEPROM;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LINT_H
@@ -0,0 +1,151 @@
+/**
+ * Hardware of the linter. Implements the functions ArduinoMock, GPIOMock, MySensorsMock and EEPROMMock provide to
+ * the unit tests: the EEPROM is the image of the calling worker (pu8LintEEPROM), pins and the radio do nothing.
+ * MyMessageMock and the bus mocks are linked as they are, their call counters are shared and nobody reads them.
+ */
+#include <string.h>
+
+#include "EEPROM.h"
+
+extern "C"
+{
+#include "ArduinoMock.h"
+#include "GPIOMock.h"
+#include "MySensorsMock.h"
+#include "lint.h"
+
+    PINCFG_THREAD_LOCAL uint8_t *pu8LintEEPROM = NULL;
+
+    // MySensorsWrapper reads the analog mock directly in UNIT_TEST builds
+    uint16_t mock_analogRead_u16Return = 512;
+    uint32_t mock_analogRead_u32Called;
+    uint8_t mock_analogRead_u8LastPin;
+
+    // MySensors
+    bool send(MyMessage msg, const bool requestEcho)
+    {
+        (void)msg;
+        (void)requestEcho;
+        return true;
+    }
+
+    bool request(const uint8_t u8Id, const uint8_t u8VariableType, const uint8_t u8Destination)
+    {
+        (void)u8Id;
+        (void)u8VariableType;
+        (void)u8Destination;
+        return true;
+    }
+
+    bool present(const uint8_t u8Id, const mysensors_sensor_t sensorType, const char *pcName, const bool requestEcho)
+    {
+        (void)u8Id;
+        (void)sensorType;
+        (void)pcName;
+        (void)requestEcho;
+        return true;
+    }
+
+    uint8_t getNodeId(void)
+    {
+        return 0;
+    }
+
+    void wait(const uint32_t u32WaitMS)
+    {
+        (void)u32WaitMS;
+    }
+
+    int8_t hwCPUTemperature(void)
+    {
+        return 25;
+    }
+
+    void hwWriteConfigBlock(void *buf, void *addr, size_t length)
+    {
+        size_t address = (size_t)addr;
+        if (address < LINT_EEPROM_SZ_D && length <= LINT_EEPROM_SZ_D - address)
+            memcpy(&pu8LintEEPROM[address], buf, length);
+    }
+
+    void hwReadConfigBlock(void *buf, void *addr, size_t length)
+    {
+        size_t address = (size_t)addr;
+        if (address < LINT_EEPROM_SZ_D && length <= LINT_EEPROM_SZ_D - address)
+            memcpy(buf, &pu8LintEEPROM[address], length);
+        else
+            memset(buf, 0xFF, length);
+    }
+
+#ifdef MY_TRANSPORT_ERROR_LOG
+    uint8_t transportGetErrorLogCount(void)
+    {
+        return 0;
+    }
+
+    bool transportGetErrorLogEntry(uint8_t index, TransportErrorLogEntry_t *entry)
+    {
+        (void)index;
+        (void)entry;
+        return false;
+    }
+
+    void transportClearErrorLog(void)
+    {
+    }
+
+    uint32_t transportGetTotalErrorCount(void)
+    {
+        return 0;
+    }
+#endif // MY_TRANSPORT_ERROR_LOG
+
+    // Arduino, the clock stands still
+    uint32_t millis()
+    {
+        return 0;
+    }
+
+    uint32_t micros()
+    {
+        return 0;
+    }
+
+    void pinMode(uint8_t u8Pin, uint8_t u8Mode)
+    {
+        (void)u8Pin;
+        (void)u8Mode;
+    }
+
+    uint8_t digitalRead(uint8_t u8Pin)
+    {
+        (void)u8Pin;
+        return HIGH;
+    }
+
+    void digitalWrite(uint8_t u8Pin, uint8_t u8Value)
+    {
+        (void)u8Pin;
+        (void)u8Value;
+    }
+}
+
+// EEPROM
+uint8_t EEPROMClass::read(int idx)
+{
+    if (idx < 0 || idx >= LINT_EEPROM_SZ_D)
+        return 0xFF;
+
+    return pu8LintEEPROM[idx];
+}
+
+void EEPROMClass::write(int idx, uint8_t val)
+{
+    if (idx >= 0 && idx < LINT_EEPROM_SZ_D)
+        pu8LintEEPROM[idx] = val;
+}
+
+void EEPROMClass::update(int idx, uint8_t val)
+{
+    write(idx, val);
+}
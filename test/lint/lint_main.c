@@ -0,0 +1,522 @@
+/**
+ * Config linter for fleets. Checks config files with the library parser on a pool of worker threads, each with its
+ * own arena and EEPROM image, and writes a JSON report: per file the validation messages, the arena bytes
+ * PinCfgCsv_eValidate reports and the peak arena use of the boot, the EEPROM bytes of the text and as stored, and
+ * the boot time measured on the host and scaled to the targets. Built by `make lint`.
+ *
+ * The arena is the static one of the nodes, so the byte counts are the ones the node reports for the same data
+ * model (pointer_bytes in the report, build with LINT_CFLAGS=-m32 for the 32-bit targets).
+ */
+#include <dirent.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Memory.h"
+#include "PersistentConfiguration.h"
+#include "PinCfgCsv.h"
+#include "lint.h"
+
+#define LINT_ARENA_SZ_D 65536U
+#define LINT_OUT_SZ_D 4096U
+#define LINT_MAX_TARGETS_D 16
+#define LINT_MAX_RUNS_D 100000U
+
+PINCFG_RESULT_T PinCfgCsv_eInitMemoryAndTypes(uint8_t *pu8Memory, size_t szMemorySize);
+
+// target boot time = host boot time * factor, rough values for an -O2 host build on a ~4 GHz x86-64 core
+typedef struct LINT_TARGET_S
+{
+    char acName[32];
+    double dFactor;
+} LINT_TARGET_T;
+
+typedef struct LINT_OPTIONS_S
+{
+    const char *pcOutPath;
+    const char *pcExtension;
+    uint32_t u32Threads;
+    uint32_t u32TimingMs; // CPU time each file is booted for, 0 skips the timing
+    bool bWarningsFail;
+} LINT_OPTIONS_T;
+
+typedef struct LINT_FILE_S
+{
+    char *pcPath;
+    char *pcMessages; // output of PinCfgCsv_eValidate, one message per line
+    size_t szArenaBytes;
+    size_t szArenaPeak;
+    uint64_t u64BootNs;
+    uint32_t u32Warnings;
+    uint32_t u32Errors;
+    uint16_t u16EepromRaw;
+    uint16_t u16EepromStored;
+    PINCFG_RESULT_T eResult;
+    PERCFG_RESULT_T eSaveResult;
+    bool bRead;
+} LINT_FILE_T;
+
+// a worker thread, the arena comes first to get the alignment of malloc
+typedef struct LINT_THREAD_S
+{
+    uint8_t au8Arena[LINT_ARENA_SZ_D];
+    uint8_t au8EEPROM[LINT_EEPROM_SZ_D];
+    char acOut[LINT_OUT_SZ_D];
+    pthread_t sThread;
+} LINT_THREAD_T;
+
+static LINT_OPTIONS_T _sOpt = {
+    .pcExtension = ".csv",
+    .u32TimingMs = 20,
+};
+static LINT_TARGET_T _asTargets[LINT_MAX_TARGETS_D] = {
+    {"avr", 2000.0},
+    {"rp2040", 120.0},
+    {"stm32f1", 100.0},
+    {"stm32f4", 40.0},
+    {"esp32", 30.0},
+};
+static size_t _szTargetCount = 5;
+static LINT_FILE_T *_pasFiles;
+static size_t _szFileCount;
+static size_t _szFileMax;
+static size_t _szNextFile;
+static pthread_mutex_t _sNextLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t Lint_u64Ns(clockid_t eClock)
+{
+    struct timespec sTs;
+    clock_gettime(eClock, &sTs);
+    return (uint64_t)sTs.tv_sec * 1000000000ULL + (uint64_t)sTs.tv_nsec;
+}
+
+static char *Lint_pcReadFile(const char *pcPath)
+{
+    FILE *psFile = fopen(pcPath, "rb");
+    if (psFile == NULL)
+        return NULL;
+
+    char *pcData = NULL;
+    long lSize = (fseek(psFile, 0, SEEK_END) == 0) ? ftell(psFile) : -1;
+    if (lSize >= 0 && fseek(psFile, 0, SEEK_SET) == 0)
+    {
+        pcData = (char *)malloc((size_t)lSize + 1);
+        if (pcData != NULL)
+        {
+            size_t szRead = fread(pcData, 1, (size_t)lSize, psFile);
+            pcData[szRead] = '\0';
+        }
+    }
+    fclose(psFile);
+
+    return pcData;
+}
+
+// arena bytes the node needs at least, permanent and temporary allocations since the last Memory_eInit
+static size_t Lint_szArenaPeak(void)
+{
+    char acStats[MEMORY_STATS_TEXT_MAX_SZ];
+    (void)Memory_szFormatStats(acStats, sizeof(acStats));
+
+    const char *pcMinFree = strstr(acStats, "MINFREE:");
+    if (pcMinFree == NULL)
+        return 0;
+
+    // Memory_eInit ends the arena at a pointer aligned offset
+    size_t szArena = ((LINT_ARENA_SZ_D - 1U) / sizeof(void *)) * sizeof(void *);
+    return szArena - (size_t)strtoul(pcMinFree + 8, NULL, 10);
+}
+
+static void Lint_vCheck(LINT_THREAD_T *psThread, LINT_FILE_T *psFile)
+{
+    char *pcCfg = Lint_pcReadFile(psFile->pcPath);
+    if (pcCfg == NULL)
+        return;
+    psFile->bRead = true;
+    psFile->eSaveResult = PERCFG_ERROR_E;
+
+    size_t szLen = strlen(pcCfg);
+    psFile->u16EepromRaw = (szLen < UINT16_MAX) ? (uint16_t)(szLen + 1) : UINT16_MAX;
+
+    memset(psThread->au8EEPROM, 0xFF, sizeof(psThread->au8EEPROM));
+    psThread->acOut[0] = '\0';
+    psFile->eResult = PinCfgCsv_eInitMemoryAndTypes(psThread->au8Arena, sizeof(psThread->au8Arena));
+    if (psFile->eResult == PINCFG_OK_E)
+    {
+        psFile->eResult = PinCfgCsv_eValidate(
+            pcCfg, &psFile->szArenaBytes, psThread->acOut, (uint16_t)sizeof(psThread->acOut));
+        // as the CLI stores it, the saved config is what the timed boot loads
+        psFile->eSaveResult = PersistentCfg_eSaveConfig(pcCfg);
+        if (psFile->eSaveResult == PERCFG_OK_E)
+            (void)PersistentCfg_eGetStoredSize(&psFile->u16EepromStored);
+    }
+    psFile->pcMessages = strdup(psThread->acOut);
+    for (const char *pcLine = psThread->acOut; *pcLine != '\0';)
+    {
+        if (pcLine[0] == 'W' && pcLine[1] == ':')
+            psFile->u32Warnings++;
+        else if (pcLine[0] == 'E' && pcLine[1] == ':')
+            psFile->u32Errors++;
+        const char *pcEnd = strchr(pcLine, '\n');
+        pcLine = (pcEnd != NULL) ? pcEnd + 1 : pcLine + strlen(pcLine);
+    }
+
+    if ((psFile->eResult == PINCFG_OK_E || psFile->eResult == PINCFG_WARNINGS_E) && _sOpt.u32TimingMs > 0)
+    {
+        uint64_t u64BudgetNs = (uint64_t)_sOpt.u32TimingMs * 1000000ULL;
+        uint64_t u64Start = Lint_u64Ns(CLOCK_THREAD_CPUTIME_ID);
+        uint64_t u64Elapsed;
+        uint32_t u32Runs = 0;
+        do
+        {
+            (void)PinCfgCsv_eInit(psThread->au8Arena, sizeof(psThread->au8Arena), pcCfg);
+            u32Runs++;
+            u64Elapsed = Lint_u64Ns(CLOCK_THREAD_CPUTIME_ID) - u64Start;
+        } while (u64Elapsed < u64BudgetNs && u32Runs < LINT_MAX_RUNS_D);
+        psFile->u64BootNs = u64Elapsed / u32Runs;
+        psFile->szArenaPeak = Lint_szArenaPeak();
+    }
+
+    free(pcCfg);
+}
+
+static void *Lint_pvWorker(void *pvArg)
+{
+    LINT_THREAD_T *psThread = (LINT_THREAD_T *)pvArg;
+    pu8LintEEPROM = psThread->au8EEPROM;
+
+    // files are taken one by one, their cost differs a lot
+    for (;;)
+    {
+        pthread_mutex_lock(&_sNextLock);
+        size_t szIdx = _szNextFile++;
+        pthread_mutex_unlock(&_sNextLock);
+        if (szIdx >= _szFileCount)
+            break;
+
+        Lint_vCheck(psThread, &_pasFiles[szIdx]);
+    }
+
+    return NULL;
+}
+
+static bool Lint_bAddFile(const char *pcDir, const char *pcName)
+{
+    if (_szFileCount == _szFileMax)
+    {
+        size_t szMax = (_szFileMax > 0) ? _szFileMax * 2 : 64;
+        LINT_FILE_T *pasFiles = (LINT_FILE_T *)realloc(_pasFiles, szMax * sizeof(LINT_FILE_T));
+        if (pasFiles == NULL)
+            return false;
+        _pasFiles = pasFiles;
+        _szFileMax = szMax;
+    }
+
+    size_t szLen = ((pcDir != NULL) ? strlen(pcDir) + 1 : 0) + strlen(pcName) + 1;
+    char *pcPath = (char *)malloc(szLen);
+    if (pcPath == NULL)
+        return false;
+    if (pcDir != NULL)
+        snprintf(pcPath, szLen, "%s/%s", pcDir, pcName);
+    else
+        snprintf(pcPath, szLen, "%s", pcName);
+
+    memset(&_pasFiles[_szFileCount], 0, sizeof(LINT_FILE_T));
+    _pasFiles[_szFileCount++].pcPath = pcPath;
+
+    return true;
+}
+
+static int Lint_iComparePaths(const void *pvA, const void *pvB)
+{
+    return strcmp(((const LINT_FILE_T *)pvA)->pcPath, ((const LINT_FILE_T *)pvB)->pcPath);
+}
+
+// a file as it is, the files of a directory with the extension, sorted
+static bool Lint_bAddPath(const char *pcPath)
+{
+    struct stat sStat;
+    if (stat(pcPath, &sStat) != 0 || !S_ISDIR(sStat.st_mode))
+        return Lint_bAddFile(NULL, pcPath);
+
+    DIR *psDir = opendir(pcPath);
+    if (psDir == NULL)
+        return false;
+
+    bool bOk = true;
+    size_t szFirst = _szFileCount;
+    size_t szExtLen = strlen(_sOpt.pcExtension);
+    struct dirent *psEntry;
+    while (bOk && (psEntry = readdir(psDir)) != NULL)
+    {
+        size_t szLen = strlen(psEntry->d_name);
+        if (psEntry->d_name[0] != '.' && szLen > szExtLen &&
+            strcmp(&psEntry->d_name[szLen - szExtLen], _sOpt.pcExtension) == 0)
+            bOk = Lint_bAddFile(pcPath, psEntry->d_name);
+    }
+    closedir(psDir);
+    qsort(&_pasFiles[szFirst], _szFileCount - szFirst, sizeof(LINT_FILE_T), Lint_iComparePaths);
+
+    return bOk;
+}
+
+static void Lint_vJsonString(FILE *psOut, const char *pcStr, size_t szLen)
+{
+    fputc('"', psOut);
+    for (size_t i = 0; i < szLen; i++)
+    {
+        unsigned char u8Char = (unsigned char)pcStr[i];
+        if (u8Char == '"' || u8Char == '\\')
+            fprintf(psOut, "\\%c", u8Char);
+        else if (u8Char < 0x20)
+            fprintf(psOut, "\\u%04x", (unsigned)u8Char);
+        else
+            fputc(u8Char, psOut);
+    }
+    fputc('"', psOut);
+}
+
+static const char *Lint_pcStatus(const LINT_FILE_T *psFile)
+{
+    if (!psFile->bRead)
+        return "unreadable";
+    if (psFile->eResult == PINCFG_WARNINGS_E)
+        return "warnings";
+    if (psFile->eResult != PINCFG_OK_E)
+        return "error";
+    return "ok";
+}
+
+static bool Lint_bFailed(const LINT_FILE_T *psFile)
+{
+    if (!psFile->bRead || psFile->eSaveResult != PERCFG_OK_E)
+        return true;
+    if (psFile->eResult == PINCFG_WARNINGS_E)
+        return _sOpt.bWarningsFail;
+
+    return psFile->eResult != PINCFG_OK_E;
+}
+
+static void Lint_vReport(FILE *psOut)
+{
+    fprintf(
+        psOut,
+        "{\n  \"pointer_bytes\": %u,\n  \"arena_mode\": \"static\",\n  \"eeprom_max\": %u,\n  \"eeprom_text_max\": %u,\n",
+        (unsigned)sizeof(void *),
+        (unsigned)PINCFG_CONFIG_MAX_SZ_D,
+        (unsigned)PINCFG_CONFIG_TEXT_MAX_SZ_D);
+    fprintf(psOut, "  \"targets\": {");
+    for (size_t t = 0; t < _szTargetCount; t++)
+        fprintf(psOut, "%s\"%s\": %g", (t > 0) ? ", " : "", _asTargets[t].acName, _asTargets[t].dFactor);
+    fprintf(psOut, "},\n  \"files\": [");
+
+    for (size_t i = 0; i < _szFileCount; i++)
+    {
+        const LINT_FILE_T *psFile = &_pasFiles[i];
+        fprintf(psOut, "%s\n    {\"file\": ", (i > 0) ? "," : "");
+        Lint_vJsonString(psOut, psFile->pcPath, strlen(psFile->pcPath));
+        fprintf(psOut, ", \"result\": \"%s\"", Lint_pcStatus(psFile));
+        if (!psFile->bRead)
+        {
+            fprintf(psOut, "}");
+            continue;
+        }
+
+        fprintf(
+            psOut,
+            ", \"code\": %d, \"warnings\": %lu, \"errors\": %lu, \"messages\": [",
+            (int)psFile->eResult,
+            (unsigned long)psFile->u32Warnings,
+            (unsigned long)psFile->u32Errors);
+        bool bFirst = true;
+        for (const char *pcLine = (psFile->pcMessages != NULL) ? psFile->pcMessages : ""; *pcLine != '\0';)
+        {
+            const char *pcEnd = strchr(pcLine, '\n');
+            size_t szLen = (pcEnd != NULL) ? (size_t)(pcEnd - pcLine) : strlen(pcLine);
+            if (szLen > 0)
+            {
+                fprintf(psOut, "%s", bFirst ? "" : ", ");
+                Lint_vJsonString(psOut, pcLine, szLen);
+                bFirst = false;
+            }
+            pcLine += szLen + ((pcEnd != NULL) ? 1 : 0);
+        }
+        fprintf(
+            psOut,
+            "],\n     \"arena_bytes\": %lu, \"eeprom_raw\": %u, \"eeprom_stored\": %u, \"eeprom_fits\": %s",
+            (unsigned long)psFile->szArenaBytes,
+            (unsigned)psFile->u16EepromRaw,
+            (unsigned)psFile->u16EepromStored,
+            (psFile->eSaveResult == PERCFG_OK_E) ? "true" : "false");
+
+        if (psFile->u64BootNs == 0)
+        {
+            fprintf(psOut, "}");
+            continue;
+        }
+        fprintf(
+            psOut,
+            ",\n     \"arena_peak\": %lu, \"boot_ns_host\": %llu, \"boot_us\": {",
+            (unsigned long)psFile->szArenaPeak,
+            (unsigned long long)psFile->u64BootNs);
+        for (size_t t = 0; t < _szTargetCount; t++)
+        {
+            fprintf(
+                psOut,
+                "%s\"%s\": %.0f",
+                (t > 0) ? ", " : "",
+                _asTargets[t].acName,
+                (double)psFile->u64BootNs * _asTargets[t].dFactor / 1000.0);
+        }
+        fprintf(psOut, "}}");
+    }
+    fprintf(psOut, "\n  ]\n}\n");
+}
+
+// NAME=FACTOR replaces the factor of a target or adds one
+static bool Lint_bSetTarget(const char *pcArg)
+{
+    const char *pcEq = strchr(pcArg, '=');
+    char *pcEnd = NULL;
+    if (pcEq == NULL || pcEq == pcArg || (size_t)(pcEq - pcArg) >= sizeof(_asTargets[0].acName))
+        return false;
+    double dFactor = strtod(pcEq + 1, &pcEnd);
+    if (pcEnd == pcEq + 1 || *pcEnd != '\0' || dFactor <= 0.0)
+        return false;
+
+    size_t t = 0;
+    while (t < _szTargetCount &&
+           (strncmp(_asTargets[t].acName, pcArg, (size_t)(pcEq - pcArg)) != 0 ||
+            _asTargets[t].acName[pcEq - pcArg] != '\0'))
+        t++;
+    if (t == LINT_MAX_TARGETS_D)
+        return false;
+    if (t == _szTargetCount)
+    {
+        memcpy(_asTargets[t].acName, pcArg, (size_t)(pcEq - pcArg));
+        _asTargets[t].acName[pcEq - pcArg] = '\0';
+        _szTargetCount++;
+    }
+    _asTargets[t].dFactor = dFactor;
+
+    return true;
+}
+
+static void Lint_vUsage(const char *pcName)
+{
+    fprintf(
+        stderr,
+        "usage: %s [options] PATH...\n"
+        "  PATH          config file, or a directory of them\n"
+        "  -e EXT        extension of the configs in directories (%s)\n"
+        "  -j THREADS    worker threads (online CPUs)\n"
+        "  -m MS         CPU time each config is booted for to time it, 0 skips the timing (%lu)\n"
+        "  -t NAME=F     boot time factor of a target relative to this host, repeat for more\n"
+        "  -o FILE       write the JSON report to FILE (stdout)\n"
+        "  -W            warnings fail too\n"
+        "Exits with 1 when a config has errors, does not fit the EEPROM or cannot be read. The target times\n"
+        "are rough, calibrate the factors with a boot measured on the node.\n",
+        pcName,
+        _sOpt.pcExtension,
+        (unsigned long)_sOpt.u32TimingMs);
+}
+
+static bool Lint_bParseArgs(int argc, char **argv)
+{
+    int iOpt;
+    while ((iOpt = getopt(argc, argv, "e:j:m:t:o:Wh")) != -1)
+    {
+        switch (iOpt)
+        {
+        case 'e': _sOpt.pcExtension = optarg; break;
+        case 'j': _sOpt.u32Threads = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'm': _sOpt.u32TimingMs = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'o': _sOpt.pcOutPath = optarg; break;
+        case 'W': _sOpt.bWarningsFail = true; break;
+        case 't':
+            if (!Lint_bSetTarget(optarg))
+                return false;
+            break;
+        default: return false;
+        }
+    }
+    if (optind == argc)
+        return false;
+
+    for (int i = optind; i < argc; i++)
+    {
+        if (!Lint_bAddPath(argv[i]))
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            return false;
+        }
+    }
+
+    if (_sOpt.u32Threads == 0)
+    {
+        long lCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        _sOpt.u32Threads = (lCpus > 0) ? (uint32_t)lCpus : 1U;
+    }
+    if (_sOpt.u32Threads > _szFileCount)
+        _sOpt.u32Threads = (_szFileCount > 0) ? (uint32_t)_szFileCount : 1U;
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (!Lint_bParseArgs(argc, argv))
+    {
+        Lint_vUsage(argv[0]);
+        return 2;
+    }
+
+    LINT_THREAD_T *pasThreads = (LINT_THREAD_T *)calloc(_sOpt.u32Threads, sizeof(LINT_THREAD_T));
+    if (pasThreads == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+
+    uint64_t u64WallStart = Lint_u64Ns(CLOCK_MONOTONIC);
+    for (uint32_t i = 0; i < _sOpt.u32Threads; i++)
+        pthread_create(&pasThreads[i].sThread, NULL, Lint_pvWorker, &pasThreads[i]);
+    for (uint32_t i = 0; i < _sOpt.u32Threads; i++)
+        pthread_join(pasThreads[i].sThread, NULL);
+    uint64_t u64WallNs = Lint_u64Ns(CLOCK_MONOTONIC) - u64WallStart;
+    free(pasThreads);
+
+    FILE *psOut = (_sOpt.pcOutPath != NULL) ? fopen(_sOpt.pcOutPath, "w") : stdout;
+    if (psOut == NULL)
+    {
+        fprintf(stderr, "%s: cannot write\n", _sOpt.pcOutPath);
+        return 2;
+    }
+    Lint_vReport(psOut);
+    if (psOut != stdout)
+        fclose(psOut);
+
+    size_t szFailed = 0, szWarnings = 0;
+    for (size_t i = 0; i < _szFileCount; i++)
+    {
+        szFailed += Lint_bFailed(&_pasFiles[i]) ? 1U : 0U;
+        szWarnings += (_pasFiles[i].eResult == PINCFG_WARNINGS_E) ? 1U : 0U;
+        free(_pasFiles[i].pcPath);
+        free(_pasFiles[i].pcMessages);
+    }
+    free(_pasFiles);
+    fprintf(
+        stderr,
+        "%lu configs on %lu threads in %.3f s: %lu with warnings, %lu failed\n",
+        (unsigned long)_szFileCount,
+        (unsigned long)_sOpt.u32Threads,
+        (double)u64WallNs / 1e9,
+        (unsigned long)szWarnings,
+        (unsigned long)szFailed);
+
+    return (szFailed > 0) ? 1 : 0;
+}
@@ -45,12 +45,57 @@ MyMessage &MyMessage::setVersion(void)
     return *this;
 }
 
+MyMessage &MyMessage::setPayloadType(const mysensors_payload_t payloadType)
+{
+    BF_SET(
+        this->command_echo_payload,
+        payloadType,
+        V2_MYS_HEADER_CEP_PAYLOADTYPE_POS,
+        V2_MYS_HEADER_CEP_PAYLOADTYPE_SIZE);
+    return *this;
+}
+
 uint8_t mock_MyMessage_setSensor_sensorId;
 uint32_t mock_MyMessage_setSensor_u32Called;
 MyMessage &MyMessage::setSensor(const uint8_t sensorId)
 {
     mock_MyMessage_setSensor_sensorId = sensorId;
     mock_MyMessage_setSensor_u32Called++;
+    this->sensor = sensorId;
+    return *this;
+}
+
+MyMessage &MyMessage::setSender(const uint8_t senderId)
+{
+    this->sender = senderId;
+    return *this;
+}
+
+MyMessage &MyMessage::setDestination(const uint8_t destinationId)
+{
+    this->destination = destinationId;
+    return *this;
+}
+
+MyMessage &MyMessage::setCommand(const mysensors_command_t command)
+{
+    BF_SET(this->command_echo_payload, command, V2_MYS_HEADER_CEP_COMMAND_POS, V2_MYS_HEADER_CEP_COMMAND_SIZE);
+    return *this;
+}
+
+mysensors_command_t MyMessage::getCommand(void) const
+{
+    return static_cast<mysensors_command_t>(
+        BF_GET(this->command_echo_payload, V2_MYS_HEADER_CEP_COMMAND_POS, V2_MYS_HEADER_CEP_COMMAND_SIZE));
+}
+
+MyMessage &MyMessage::setRequestEcho(const bool requestEcho)
+{
+    BF_SET(
+        this->command_echo_payload,
+        requestEcho,
+        V2_MYS_HEADER_CEP_ECHOREQUEST_POS,
+        V2_MYS_HEADER_CEP_ECHOREQUEST_SIZE);
     return *this;
 }
 
@@ -60,6 +105,7 @@ MyMessage &MyMessage::setType(const uint8_t messageType)
 {
     mock_MyMessage_setType_messageType = messageType;
     mock_MyMessage_setType_u32Called++;
+    this->type = messageType;
     return *this;
 }
 
@@ -69,6 +115,8 @@ MyMessage &MyMessage::set(const uint8_t value)
 {
     mock_MyMessage_set_uint8_t_value = value;
     mock_MyMessage_set_uint8_t_u32Called++;
+    this->bValue = value;
+    (void)this->setPayloadType(P_BYTE);
     return *this;
 }
 
@@ -84,6 +132,7 @@ MyMessage &MyMessage::set(const char *value)
     // null terminate string
     this->data[szCharsToCopy] = 0;
     mock_MyMessage_set_pChar_u32Called++;
+    (void)this->setPayloadType(P_STRING);
     return *this;
 }
 
@@ -103,6 +152,7 @@ MyMessage &MyMessage::set(const int16_t value)
     mock_MyMessage_set_int16_t_value = value;
     mock_MyMessage_set_int16_t_u32Called++;
     this->iValue = value;
+    (void)this->setPayloadType(P_INT16);
     return *this;
 }
 
@@ -113,6 +163,7 @@ MyMessage &MyMessage::set(const uint16_t value)
     mock_MyMessage_set_uint16_t_value = value;
     mock_MyMessage_set_uint16_t_u32Called++;
     this->uiValue = value;
+    (void)this->setPayloadType(P_UINT16);
     return *this;
 }
 
@@ -123,6 +174,7 @@ MyMessage &MyMessage::set(const int32_t value)
     mock_MyMessage_set_int32_t_value = value;
     mock_MyMessage_set_int32_t_u32Called++;
     this->lValue = value;
+    (void)this->setPayloadType(P_LONG32);
     return *this;
 }
 
@@ -133,6 +185,7 @@ MyMessage &MyMessage::set(const uint32_t value)
     mock_MyMessage_set_uint32_t_value = value;
     mock_MyMessage_set_uint32_t_u32Called++;
     this->ulValue = value;
+    (void)this->setPayloadType(P_ULONG32);
     return *this;
 }
 
@@ -76,6 +76,12 @@ extern "C"
         return mock_transportGetNodeId_u8Return;
     }
 
+    uint8_t mock_getNodeId_u8Return;
+    uint8_t getNodeId(void)
+    {
+        return mock_getNodeId_u8Return;
+    }
+
     uint32_t mock_wait_u32WaitMS;
     uint32_t mock_wait_u32Called;
     void wait(const uint32_t u32WaitMS)
@@ -148,6 +154,7 @@ extern "C"
         (void)memset((void *)mock_send_message, 0u, sizeof(mock_send_message));
 
         mock_transportGetNodeId_u8Return = 0;
+        mock_getNodeId_u8Return = 0;
 
         mock_wait_u32Called = 0;
         mock_hwWriteConfigBlock_u32Called = 0;
@@ -15,6 +15,7 @@ extern bool mock_bPresent_bReturn;
 extern uint32_t mock_bPresent_u32Called;
 
 extern uint8_t mock_transportGetNodeId_u8Return;
+extern uint8_t mock_getNodeId_u8Return;
 
 extern char mock_sendSketchInfo_name[50];
 extern char mock_sendSketchInfo_version[50];
@@ -55,6 +56,7 @@ bool present(
     const char *description,
     const bool requestEcho);
 uint8_t transportGetNodeId(void);
+uint8_t getNodeId(void);
 
 void wait(const uint32_t u32WaitMS);
 void hwWriteConfigBlock(void *buf, void *addr, size_t length);
@@ -0,0 +1,71 @@
+#ifndef SIM_H
+#define SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "PinCfgCsv.h"
+
+#define SIM_PINS_D 256
+#define SIM_EEPROM_SZ_D 1024
+#define SIM_OUT_BUF_SZ_D 16384
+
+    // one scripted input change, relative to the start of the script period
+    typedef struct SIM_STIMULUS_S
+    {
+        uint32_t u32Ms;
+        uint8_t u8Pin;
+        uint8_t u8Level;
+    } SIM_STIMULUS_T;
+
+    typedef struct SIM_SCRIPT_S
+    {
+        SIM_STIMULUS_T *pasSteps; // sorted by u32Ms
+        size_t szCount;
+    } SIM_SCRIPT_T;
+
+// MySensors node ids are 1..254, every block of that many nodes gets a gateway stream of its own
+#define SIM_GATEWAY_NODES_D 254U
+
+    // a worker thread, buffers the messages of its nodes for one gateway at a time
+    typedef struct SIM_WORKER_S
+    {
+        char acOut[SIM_OUT_BUF_SZ_D];
+        size_t szOutLen;
+        uint32_t u32Gateway; // stream acOut goes to
+    } SIM_WORKER_T;
+
+    // one virtual node - pinCfg instance plus the hardware it sees
+    typedef struct SIM_NODE_S
+    {
+        PINCFG_CTX_T *psCtx;
+        SIM_WORKER_T *psWorker;
+        const SIM_SCRIPT_T *psScript;
+        size_t szScriptIdx;       // next step of psScript
+        uint32_t u32ScriptStartMs; // start of the current script period
+        uint32_t u32Gateway;
+        uint32_t u32Id;  // MySensors node id within the gateway, 1..SIM_GATEWAY_NODES_D
+        uint32_t u32Now; // virtual clock
+        uint32_t u32Loops;
+        uint32_t u32Messages;
+        uint64_t u64LoopNs; // worker CPU time spent in this node's loop
+        uint8_t au8Pins[SIM_PINS_D];
+        uint8_t au8EEPROM[SIM_EEPROM_SZ_D];
+    } SIM_NODE_T;
+
+    // node the calling worker runs right now, the hardware layer works on it
+    extern PINCFG_THREAD_LOCAL SIM_NODE_T *psSimNode;
+
+    // writes out and empties the worker's message buffer
+    void Sim_vFlush(SIM_WORKER_T *psWorker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_H
@@ -0,0 +1,198 @@
+/**
+ * Hardware of the virtual nodes. Implements the functions ArduinoMock, GPIOMock, MySensorsMock and EEPROMMock
+ * provide to the unit tests, but on the state of the node the calling worker runs (psSimNode) instead of the
+ * globals the tests inspect. MyMessageMock and the bus mocks are linked as they are, their call counters are
+ * shared by the workers and nobody reads them.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "EEPROM.h"
+
+extern "C"
+{
+#include "ArduinoMock.h"
+#include "GPIOMock.h"
+#include "MySensorsMock.h"
+#include "sim.h"
+
+    PINCFG_THREAD_LOCAL SIM_NODE_T *psSimNode = NULL;
+
+    // MySensorsWrapper reads the analog mock directly in UNIT_TEST builds
+    uint16_t mock_analogRead_u16Return = 512;
+    uint32_t mock_analogRead_u32Called;
+    uint8_t mock_analogRead_u8LastPin;
+
+    static void vSimEmit(uint16_t u16ChildId, uint8_t u8Command, uint8_t u8Type, const char *pcPayload)
+    {
+        SIM_WORKER_T *psWorker = psSimNode->psWorker;
+        char acLine[128];
+
+        // MySensors serial protocol, node-id;child-sensor-id;command;ack;type;payload
+        int iLen = snprintf(
+            acLine,
+            sizeof(acLine),
+            "%lu;%u;%u;0;%u;%s\n",
+            (unsigned long)psSimNode->u32Id,
+            (unsigned)u16ChildId,
+            (unsigned)u8Command,
+            (unsigned)u8Type,
+            pcPayload);
+        if (iLen < 0)
+            return;
+        if ((size_t)iLen >= sizeof(acLine))
+            iLen = (int)sizeof(acLine) - 1;
+
+        if (psWorker->u32Gateway != psSimNode->u32Gateway ||
+            psWorker->szOutLen + (size_t)iLen > sizeof(psWorker->acOut))
+        {
+            Sim_vFlush(psWorker);
+            psWorker->u32Gateway = psSimNode->u32Gateway;
+        }
+        memcpy(&psWorker->acOut[psWorker->szOutLen], acLine, (size_t)iLen);
+        psWorker->szOutLen += (size_t)iLen;
+        psSimNode->u32Messages++;
+    }
+
+    static void vSimPayload(const MyMessage &msg, char *pcOut, size_t szOut)
+    {
+        switch (msg.getPayloadType())
+        {
+        case P_BYTE: snprintf(pcOut, szOut, "%u", (unsigned)msg.bValue); break;
+        case P_INT16: snprintf(pcOut, szOut, "%d", (int)msg.iValue); break;
+        case P_UINT16: snprintf(pcOut, szOut, "%u", (unsigned)msg.uiValue); break;
+        case P_LONG32: snprintf(pcOut, szOut, "%ld", (long)msg.lValue); break;
+        case P_ULONG32: snprintf(pcOut, szOut, "%lu", (unsigned long)msg.ulValue); break;
+        case P_STRING: snprintf(pcOut, szOut, "%.*s", (int)MAX_PAYLOAD_SIZE, msg.data); break;
+        default: pcOut[0] = '\0'; break;
+        }
+    }
+
+    // MySensors
+    bool send(MyMessage msg, const bool requestEcho)
+    {
+        (void)requestEcho;
+        char acPayload[MAX_PAYLOAD_SIZE * 4];
+
+        vSimPayload(msg, acPayload, sizeof(acPayload));
+        vSimEmit(msg.sensor, C_SET, msg.type, acPayload);
+
+        return true;
+    }
+
+    bool request(const uint8_t u8Id, const uint8_t u8VariableType, const uint8_t u8Destination)
+    {
+        (void)u8Destination;
+        vSimEmit(u8Id, C_REQ, u8VariableType, "");
+        return true;
+    }
+
+    bool present(const uint8_t u8Id, const mysensors_sensor_t sensorType, const char *pcName, const bool requestEcho)
+    {
+        (void)requestEcho;
+        vSimEmit(u8Id, C_PRESENTATION, (uint8_t)sensorType, (pcName != NULL) ? pcName : "");
+        return true;
+    }
+
+    uint8_t getNodeId(void)
+    {
+        return (uint8_t)psSimNode->u32Id;
+    }
+
+    void wait(const uint32_t u32WaitMS)
+    {
+        (void)u32WaitMS;
+    }
+
+    int8_t hwCPUTemperature(void)
+    {
+        return 25;
+    }
+
+    void hwWriteConfigBlock(void *buf, void *addr, size_t length)
+    {
+        size_t address = (size_t)addr;
+        if (address < SIM_EEPROM_SZ_D && length <= SIM_EEPROM_SZ_D - address)
+            memcpy(&psSimNode->au8EEPROM[address], buf, length);
+    }
+
+    void hwReadConfigBlock(void *buf, void *addr, size_t length)
+    {
+        size_t address = (size_t)addr;
+        if (address < SIM_EEPROM_SZ_D && length <= SIM_EEPROM_SZ_D - address)
+            memcpy(buf, &psSimNode->au8EEPROM[address], length);
+        else
+            memset(buf, 0xFF, length);
+    }
+
+#ifdef MY_TRANSPORT_ERROR_LOG
+    // the virtual radio does not fail
+    uint8_t transportGetErrorLogCount(void)
+    {
+        return 0;
+    }
+
+    bool transportGetErrorLogEntry(uint8_t index, TransportErrorLogEntry_t *entry)
+    {
+        (void)index;
+        (void)entry;
+        return false;
+    }
+
+    void transportClearErrorLog(void)
+    {
+    }
+
+    uint32_t transportGetTotalErrorCount(void)
+    {
+        return 0;
+    }
+#endif // MY_TRANSPORT_ERROR_LOG
+
+    // Arduino
+    uint32_t millis()
+    {
+        return psSimNode->u32Now;
+    }
+
+    uint32_t micros()
+    {
+        return psSimNode->u32Now * 1000U;
+    }
+
+    void pinMode(uint8_t u8Pin, uint8_t u8Mode)
+    {
+        if (u8Mode == INPUT_PULLUP)
+            psSimNode->au8Pins[u8Pin] = HIGH;
+    }
+
+    uint8_t digitalRead(uint8_t u8Pin)
+    {
+        return psSimNode->au8Pins[u8Pin];
+    }
+
+    void digitalWrite(uint8_t u8Pin, uint8_t u8Value)
+    {
+        psSimNode->au8Pins[u8Pin] = u8Value;
+    }
+}
+
+// EEPROM
+uint8_t EEPROMClass::read(int idx)
+{
+    if (idx < 0 || idx >= SIM_EEPROM_SZ_D)
+        return 0xFF;
+
+    return psSimNode->au8EEPROM[idx];
+}
+
+void EEPROMClass::write(int idx, uint8_t val)
+{
+    if (idx >= 0 && idx < SIM_EEPROM_SZ_D)
+        psSimNode->au8EEPROM[idx] = val;
+}
+
+void EEPROMClass::update(int idx, uint8_t val)
+{
+    write(idx, val);
+}
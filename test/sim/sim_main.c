@@ -0,0 +1,502 @@
+/**
+ * Virtual node simulator for controller load tests. Runs many independent pinCfg instances on a pool of worker
+ * threads, each with its own config, input script, EEPROM and virtual clock, and streams the MySensors messages
+ * they send to a file or to a controller connected over TCP (like an Ethernet gateway). Built by `make sim`.
+ * MySensors node ids are 8-bit, so every SIM_GATEWAY_NODES_D nodes form a gateway with a stream of their own.
+ *
+ * Every worker advances its nodes by SIM_SLICE_MS_D of virtual time at a time and charges the thread CPU time
+ * of each slice to the node, the summary reports the loop cost per node.
+ */
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim.h"
+#include "sim_net.h"
+
+#define SIM_SLICE_MS_D 1000U
+#define SIM_MAX_FILES_D 64
+
+// used when no -c is given, input 16 toggles o1 and input 15 toggles o2 on a long press
+static const char *_pcDefaultCfg = "S,o1,13,o2,12/"
+                                   "I,i1,16,i2,15/"
+                                   "T,t1,i1,0,1,o1,0/"
+                                   "T,t2,i2,2,1,o2,0/";
+static SIM_STIMULUS_T _asDefaultSteps[] = {{1000, 16, 0}, {1100, 16, 1}, {3000, 15, 0}, {4500, 15, 1}};
+
+typedef struct SIM_OPTIONS_S
+{
+    const char *apcCfgPaths[SIM_MAX_FILES_D];
+    const char *apcScriptPaths[SIM_MAX_FILES_D];
+    const char *pcOutPath;
+    const char *pcReportPath;
+    size_t szCfgCount;
+    size_t szScriptCount;
+    uint32_t u32Nodes;
+    uint32_t u32Threads;
+    uint32_t u32DurationMs;
+    uint32_t u32StepMs;
+    uint32_t u32PeriodMs;
+    uint16_t u16Port;
+    bool bRealTime;
+} SIM_OPTIONS_T;
+
+typedef struct SIM_THREAD_S
+{
+    SIM_WORKER_T sWorker;
+    pthread_t sThread;
+    uint32_t u32First; // nodes u32First, u32First + threads, ...
+} SIM_THREAD_T;
+
+static SIM_OPTIONS_T _sOpt = {
+    .u32Nodes = 1000,
+    .u32DurationMs = 60000,
+    .u32StepMs = 1,
+};
+static const char **_ppcCfgs;
+static SIM_SCRIPT_T *_pasScripts;
+static SIM_NODE_T *_pasNodes;
+static FILE **_papsOut; // one stream per gateway
+static uint32_t _u32Gateways;
+static pthread_mutex_t _sOutLock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t _u64WallStartNs;
+
+void Sim_vFlush(SIM_WORKER_T *psWorker)
+{
+    if (psWorker->szOutLen == 0)
+        return;
+
+    pthread_mutex_lock(&_sOutLock);
+    (void)fwrite(psWorker->acOut, 1, psWorker->szOutLen, _papsOut[psWorker->u32Gateway]);
+    pthread_mutex_unlock(&_sOutLock);
+    psWorker->szOutLen = 0;
+}
+
+static uint64_t Sim_u64Ns(clockid_t eClock)
+{
+    struct timespec sTs;
+    clock_gettime(eClock, &sTs);
+    return (uint64_t)sTs.tv_sec * 1000000000ULL + (uint64_t)sTs.tv_nsec;
+}
+
+static char *Sim_pcReadFile(const char *pcPath)
+{
+    FILE *psFile = fopen(pcPath, "rb");
+    if (psFile == NULL)
+        return NULL;
+
+    char *pcData = NULL;
+    long lSize = (fseek(psFile, 0, SEEK_END) == 0) ? ftell(psFile) : -1;
+    if (lSize >= 0 && fseek(psFile, 0, SEEK_SET) == 0)
+    {
+        pcData = (char *)malloc((size_t)lSize + 1);
+        if (pcData != NULL)
+        {
+            size_t szRead = fread(pcData, 1, (size_t)lSize, psFile);
+            pcData[szRead] = '\0';
+        }
+    }
+    fclose(psFile);
+
+    return pcData;
+}
+
+// lines of <ms>,<pin>,<level> in time order, # starts a comment
+static bool Sim_bLoadScript(const char *pcPath, SIM_SCRIPT_T *psScript)
+{
+    char *pcData = Sim_pcReadFile(pcPath);
+    if (pcData == NULL)
+        return false;
+
+    size_t szMax = 1;
+    for (const char *pc = pcData; *pc != '\0'; pc++)
+    {
+        if (*pc == '\n')
+            szMax++;
+    }
+    psScript->pasSteps = (SIM_STIMULUS_T *)malloc(szMax * sizeof(SIM_STIMULUS_T));
+    psScript->szCount = 0;
+    if (psScript->pasSteps == NULL)
+    {
+        free(pcData);
+        return false;
+    }
+
+    bool bOk = true;
+    unsigned uLine = 0;
+    for (char *pcLine = strtok(pcData, "\n"); pcLine != NULL && bOk; pcLine = strtok(NULL, "\n"))
+    {
+        unsigned long ulMs, ulPin, ulLevel;
+        uLine++;
+        pcLine += strspn(pcLine, " \t\r");
+        if (*pcLine == '#' || *pcLine == '\0')
+            continue;
+
+        if (sscanf(pcLine, "%lu,%lu,%lu", &ulMs, &ulPin, &ulLevel) != 3 || ulPin >= SIM_PINS_D || ulLevel > 1)
+        {
+            fprintf(stderr, "%s:%u: expected <ms>,<pin>,<0|1>\n", pcPath, uLine);
+            bOk = false;
+        }
+        else if (psScript->szCount > 0 && ulMs < psScript->pasSteps[psScript->szCount - 1].u32Ms)
+        {
+            fprintf(stderr, "%s:%u: steps must be in time order\n", pcPath, uLine);
+            bOk = false;
+        }
+        else
+        {
+            SIM_STIMULUS_T *psStep = &psScript->pasSteps[psScript->szCount++];
+            psStep->u32Ms = (uint32_t)ulMs;
+            psStep->u8Pin = (uint8_t)ulPin;
+            psStep->u8Level = (uint8_t)ulLevel;
+        }
+    }
+    free(pcData);
+
+    return bOk;
+}
+
+static void Sim_vApplyScript(SIM_NODE_T *psNode)
+{
+    const SIM_SCRIPT_T *psScript = psNode->psScript;
+    if (psScript == NULL || psScript->szCount == 0)
+        return;
+
+    for (;;)
+    {
+        if (psNode->szScriptIdx == psScript->szCount)
+        {
+            if (_sOpt.u32PeriodMs == 0 || psNode->u32Now - psNode->u32ScriptStartMs < _sOpt.u32PeriodMs)
+                return;
+            psNode->u32ScriptStartMs += _sOpt.u32PeriodMs;
+            psNode->szScriptIdx = 0;
+        }
+
+        const SIM_STIMULUS_T *psStep = &psScript->pasSteps[psNode->szScriptIdx];
+        if (psNode->u32Now - psNode->u32ScriptStartMs < psStep->u32Ms)
+            return;
+
+        psNode->au8Pins[psStep->u8Pin] = psStep->u8Level;
+        psNode->szScriptIdx++;
+    }
+}
+
+static void Sim_vInitNode(SIM_NODE_T *psNode, uint32_t u32Idx, SIM_WORKER_T *psWorker)
+{
+    memset(psNode, 0, sizeof(SIM_NODE_T));
+    memset(psNode->au8EEPROM, 0xFF, sizeof(psNode->au8EEPROM));
+    psNode->u32Gateway = u32Idx / SIM_GATEWAY_NODES_D;
+    psNode->u32Id = u32Idx % SIM_GATEWAY_NODES_D + 1U;
+    psNode->psWorker = psWorker;
+    psNode->psScript = &_pasScripts[u32Idx % (_sOpt.szScriptCount > 0 ? _sOpt.szScriptCount : 1)];
+
+    psSimNode = psNode;
+    PINCFG_RESULT_T eResult = PinCfgCsv_eInitCtx(&psNode->psCtx, NULL, 0, _ppcCfgs[u32Idx % _sOpt.szCfgCount]);
+    if (eResult != PINCFG_OK_E && eResult != PINCFG_WARNINGS_E)
+        fprintf(
+            stderr,
+            "gateway %lu node %lu: config not applied (%d)\n",
+            (unsigned long)psNode->u32Gateway,
+            (unsigned long)psNode->u32Id,
+            (int)eResult);
+    PinCfgCsv_vPresentationCtx(psNode->psCtx);
+}
+
+static void *Sim_pvWorker(void *pvArg)
+{
+    SIM_THREAD_T *psThread = (SIM_THREAD_T *)pvArg;
+
+    for (uint32_t i = psThread->u32First; i < _sOpt.u32Nodes; i += _sOpt.u32Threads)
+        Sim_vInitNode(&_pasNodes[i], i, &psThread->sWorker);
+
+    for (uint32_t u32SliceEnd = 0; u32SliceEnd < _sOpt.u32DurationMs;)
+    {
+        u32SliceEnd = (_sOpt.u32DurationMs - u32SliceEnd > SIM_SLICE_MS_D) ? u32SliceEnd + SIM_SLICE_MS_D
+                                                                            : _sOpt.u32DurationMs;
+
+        for (uint32_t i = psThread->u32First; i < _sOpt.u32Nodes; i += _sOpt.u32Threads)
+        {
+            SIM_NODE_T *psNode = &_pasNodes[i];
+            psSimNode = psNode;
+            uint64_t u64Start = Sim_u64Ns(CLOCK_THREAD_CPUTIME_ID);
+            while (psNode->u32Now < u32SliceEnd)
+            {
+                Sim_vApplyScript(psNode);
+                PinCfgCsv_vLoopCtx(psNode->psCtx, psNode->u32Now);
+                psNode->u32Loops++;
+                psNode->u32Now += _sOpt.u32StepMs;
+            }
+            psNode->u64LoopNs += Sim_u64Ns(CLOCK_THREAD_CPUTIME_ID) - u64Start;
+        }
+
+        if (_sOpt.bRealTime)
+        {
+            uint64_t u64Due = (uint64_t)u32SliceEnd * 1000000ULL;
+            uint64_t u64Elapsed = Sim_u64Ns(CLOCK_MONOTONIC) - _u64WallStartNs;
+            Sim_vFlush(&psThread->sWorker);
+            if (u64Due > u64Elapsed)
+            {
+                struct timespec sSleep = {
+                    .tv_sec = (time_t)((u64Due - u64Elapsed) / 1000000000ULL),
+                    .tv_nsec = (long)((u64Due - u64Elapsed) % 1000000000ULL)};
+                nanosleep(&sSleep, NULL);
+            }
+        }
+    }
+    Sim_vFlush(&psThread->sWorker);
+
+    return NULL;
+}
+
+static int Sim_iCompareU64(const void *pvA, const void *pvB)
+{
+    uint64_t u64A = *(const uint64_t *)pvA;
+    uint64_t u64B = *(const uint64_t *)pvB;
+    return (u64A > u64B) - (u64A < u64B);
+}
+
+static void Sim_vReport(uint64_t u64WallNs)
+{
+    uint64_t *pau64NsPerLoop = (uint64_t *)malloc(_sOpt.u32Nodes * sizeof(uint64_t));
+    uint64_t u64CpuNs = 0, u64Loops = 0, u64Messages = 0;
+    FILE *psReport = (_sOpt.pcReportPath != NULL) ? fopen(_sOpt.pcReportPath, "w") : NULL;
+
+    if (psReport != NULL)
+        fprintf(psReport, "gateway,node,config,script,loops,messages,cpu_ns,ns_per_loop\n");
+    for (uint32_t i = 0; i < _sOpt.u32Nodes; i++)
+    {
+        const SIM_NODE_T *psNode = &_pasNodes[i];
+        uint64_t u64NsPerLoop = (psNode->u32Loops > 0) ? psNode->u64LoopNs / psNode->u32Loops : 0;
+        u64CpuNs += psNode->u64LoopNs;
+        u64Loops += psNode->u32Loops;
+        u64Messages += psNode->u32Messages;
+        if (pau64NsPerLoop != NULL)
+            pau64NsPerLoop[i] = u64NsPerLoop;
+        if (psReport != NULL)
+        {
+            fprintf(
+                psReport,
+                "%lu,%lu,%lu,%lu,%lu,%lu,%llu,%llu\n",
+                (unsigned long)psNode->u32Gateway,
+                (unsigned long)psNode->u32Id,
+                (unsigned long)(i % _sOpt.szCfgCount),
+                (unsigned long)(_sOpt.szScriptCount > 0 ? i % _sOpt.szScriptCount : 0),
+                (unsigned long)psNode->u32Loops,
+                (unsigned long)psNode->u32Messages,
+                (unsigned long long)psNode->u64LoopNs,
+                (unsigned long long)u64NsPerLoop);
+        }
+    }
+    if (psReport != NULL)
+        fclose(psReport);
+
+    fprintf(
+        stderr,
+        "%lu nodes on %lu threads, %lu ms simulated in %.3f s wall\n"
+        "%llu loops, %llu messages, %.3f s CPU in loops\n",
+        (unsigned long)_sOpt.u32Nodes,
+        (unsigned long)_sOpt.u32Threads,
+        (unsigned long)_sOpt.u32DurationMs,
+        (double)u64WallNs / 1e9,
+        (unsigned long long)u64Loops,
+        (unsigned long long)u64Messages,
+        (double)u64CpuNs / 1e9);
+    if (pau64NsPerLoop != NULL)
+    {
+        qsort(pau64NsPerLoop, _sOpt.u32Nodes, sizeof(uint64_t), Sim_iCompareU64);
+        fprintf(
+            stderr,
+            "ns per loop and node: mean %llu, p50 %llu, p99 %llu, max %llu\n",
+            (unsigned long long)((u64Loops > 0) ? u64CpuNs / u64Loops : 0),
+            (unsigned long long)pau64NsPerLoop[_sOpt.u32Nodes / 2],
+            (unsigned long long)pau64NsPerLoop[(_sOpt.u32Nodes * 99) / 100],
+            (unsigned long long)pau64NsPerLoop[_sOpt.u32Nodes - 1]);
+        free(pau64NsPerLoop);
+    }
+}
+
+static void Sim_vUsage(const char *pcName)
+{
+    fprintf(
+        stderr,
+        "usage: %s [options]\n"
+        "  -n NODES    virtual nodes (%lu)\n"
+        "  -t THREADS  worker threads (online CPUs)\n"
+        "  -d MS       simulated time (%lu)\n"
+        "  -s MS       loop period of the virtual clock (%lu)\n"
+        "  -c FILE     node config, repeat for more, nodes take them round robin\n"
+        "  -i FILE     input script of <ms>,<pin>,<level> lines, repeat for more, round robin\n"
+        "  -r MS       restart the input scripts every MS (once)\n"
+        "  -o FILE     write the messages to FILE (stdout), gateway G > 0 to FILE.G\n"
+        "  -l PORT     serve the messages to one controller connecting to 127.0.0.1:PORT, gateway G to PORT+G\n"
+        "  -R          do not run ahead of the wall clock\n"
+        "  -p FILE     per node CSV report\n"
+        "Messages use the serial protocol. Every 254 nodes form a gateway stream of their own, node-id is the\n"
+        "node within it (1..254) and child-sensor-id the logical id. More than 254 nodes need -o FILE or -l.\n"
+        "Without -c every node runs a built-in config with a built-in script.\n",
+        pcName,
+        (unsigned long)_sOpt.u32Nodes,
+        (unsigned long)_sOpt.u32DurationMs,
+        (unsigned long)_sOpt.u32StepMs);
+}
+
+static bool Sim_bParseArgs(int argc, char **argv)
+{
+    int iOpt;
+    while ((iOpt = getopt(argc, argv, "n:t:d:s:c:i:r:o:l:Rp:h")) != -1)
+    {
+        switch (iOpt)
+        {
+        case 'n': _sOpt.u32Nodes = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 't': _sOpt.u32Threads = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'd': _sOpt.u32DurationMs = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 's': _sOpt.u32StepMs = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'r': _sOpt.u32PeriodMs = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'o': _sOpt.pcOutPath = optarg; break;
+        case 'l': _sOpt.u16Port = (uint16_t)strtoul(optarg, NULL, 10); break;
+        case 'R': _sOpt.bRealTime = true; break;
+        case 'p': _sOpt.pcReportPath = optarg; break;
+        case 'c':
+            if (_sOpt.szCfgCount == SIM_MAX_FILES_D)
+                return false;
+            _sOpt.apcCfgPaths[_sOpt.szCfgCount++] = optarg;
+            break;
+        case 'i':
+            if (_sOpt.szScriptCount == SIM_MAX_FILES_D)
+                return false;
+            _sOpt.apcScriptPaths[_sOpt.szScriptCount++] = optarg;
+            break;
+        default: return false;
+        }
+    }
+
+    if (_sOpt.u32Threads == 0)
+    {
+        long lCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        _sOpt.u32Threads = (lCpus > 0) ? (uint32_t)lCpus : 1U;
+    }
+    if (_sOpt.u32Threads > _sOpt.u32Nodes)
+        _sOpt.u32Threads = _sOpt.u32Nodes;
+
+    return optind == argc && _sOpt.u32Nodes > 0 && _sOpt.u32StepMs > 0;
+}
+
+int main(int argc, char **argv)
+{
+    static SIM_SCRIPT_T sDefaultScript = {_asDefaultSteps, sizeof(_asDefaultSteps) / sizeof(_asDefaultSteps[0])};
+
+    if (!Sim_bParseArgs(argc, argv))
+    {
+        Sim_vUsage(argv[0]);
+        return 2;
+    }
+
+    // configs and scripts, the built-in pair when no config is given
+    if (_sOpt.szCfgCount == 0)
+    {
+        _ppcCfgs = &_pcDefaultCfg;
+        _sOpt.szCfgCount = 1;
+        if (_sOpt.szScriptCount == 0)
+        {
+            _pasScripts = &sDefaultScript;
+            _sOpt.szScriptCount = 1;
+            if (_sOpt.u32PeriodMs == 0)
+                _sOpt.u32PeriodMs = 5000;
+        }
+    }
+    else
+    {
+        _ppcCfgs = (const char **)calloc(_sOpt.szCfgCount, sizeof(char *));
+        for (size_t i = 0; _ppcCfgs != NULL && i < _sOpt.szCfgCount; i++)
+        {
+            _ppcCfgs[i] = Sim_pcReadFile(_sOpt.apcCfgPaths[i]);
+            if (_ppcCfgs[i] == NULL)
+            {
+                fprintf(stderr, "%s: cannot read\n", _sOpt.apcCfgPaths[i]);
+                return 1;
+            }
+        }
+    }
+    if (_pasScripts == NULL)
+    {
+        // with no scripts the single empty one keeps the inputs idle
+        _pasScripts = (SIM_SCRIPT_T *)calloc(_sOpt.szScriptCount > 0 ? _sOpt.szScriptCount : 1, sizeof(SIM_SCRIPT_T));
+        for (size_t i = 0; _pasScripts != NULL && i < _sOpt.szScriptCount; i++)
+        {
+            if (!Sim_bLoadScript(_sOpt.apcScriptPaths[i], &_pasScripts[i]))
+            {
+                fprintf(stderr, "%s: cannot load\n", _sOpt.apcScriptPaths[i]);
+                return 1;
+            }
+        }
+    }
+
+    _pasNodes = (SIM_NODE_T *)malloc(_sOpt.u32Nodes * sizeof(SIM_NODE_T));
+    SIM_THREAD_T *pasThreads = (SIM_THREAD_T *)calloc(_sOpt.u32Threads, sizeof(SIM_THREAD_T));
+    if (_ppcCfgs == NULL || _pasScripts == NULL || _pasNodes == NULL || pasThreads == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    _u32Gateways = (_sOpt.u32Nodes + SIM_GATEWAY_NODES_D - 1U) / SIM_GATEWAY_NODES_D;
+    bool bStdout = _sOpt.u16Port == 0 && (_sOpt.pcOutPath == NULL || strcmp(_sOpt.pcOutPath, "-") == 0);
+    if (bStdout && _u32Gateways > 1)
+    {
+        fprintf(stderr, "more than %u nodes need -o FILE or -l PORT\n", SIM_GATEWAY_NODES_D);
+        return 2;
+    }
+    if (_sOpt.u16Port != 0 && (uint32_t)_sOpt.u16Port + _u32Gateways - 1U > UINT16_MAX)
+    {
+        fprintf(stderr, "ports %u.. do not fit %lu gateways\n", (unsigned)_sOpt.u16Port, (unsigned long)_u32Gateways);
+        return 2;
+    }
+    _papsOut = (FILE **)calloc(_u32Gateways, sizeof(FILE *));
+    for (uint32_t i = 0; _papsOut != NULL && i < _u32Gateways; i++)
+    {
+        char acPath[4096];
+        if (_sOpt.u16Port != 0)
+            _papsOut[i] = Sim_psAcceptController((uint16_t)(_sOpt.u16Port + i));
+        else if (bStdout)
+            _papsOut[i] = stdout;
+        else if (i == 0)
+            _papsOut[i] = fopen(_sOpt.pcOutPath, "w");
+        else if (snprintf(acPath, sizeof(acPath), "%s.%lu", _sOpt.pcOutPath, (unsigned long)i) < (int)sizeof(acPath))
+            _papsOut[i] = fopen(acPath, "w");
+
+        if (_papsOut[i] == NULL)
+        {
+            fprintf(stderr, "cannot open the message output of gateway %lu\n", (unsigned long)i);
+            return 1;
+        }
+    }
+    if (_papsOut == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    _u64WallStartNs = Sim_u64Ns(CLOCK_MONOTONIC);
+    for (uint32_t i = 0; i < _sOpt.u32Threads; i++)
+    {
+        pasThreads[i].u32First = i;
+        if (pthread_create(&pasThreads[i].sThread, NULL, Sim_pvWorker, &pasThreads[i]) != 0)
+        {
+            fprintf(stderr, "cannot start worker %lu\n", (unsigned long)i);
+            return 1;
+        }
+    }
+    for (uint32_t i = 0; i < _sOpt.u32Threads; i++)
+        pthread_join(pasThreads[i].sThread, NULL);
+    uint64_t u64WallNs = Sim_u64Ns(CLOCK_MONOTONIC) - _u64WallStartNs;
+
+    for (uint32_t i = 0; i < _u32Gateways; i++)
+        fflush(_papsOut[i]);
+    Sim_vReport(u64WallNs);
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * Controller connection of the simulator. Kept apart from the library headers, the MySensors send() clashes
+ * with the socket one.
+ */
+#include "sim_net.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+FILE *Sim_psAcceptController(uint16_t u16Port)
+{
+    struct sockaddr_in sAddr = {0};
+    int iOne = 1;
+    int iListen = socket(AF_INET, SOCK_STREAM, 0);
+    if (iListen < 0)
+        return NULL;
+
+    sAddr.sin_family = AF_INET;
+    sAddr.sin_port = htons(u16Port);
+    sAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    (void)setsockopt(iListen, SOL_SOCKET, SO_REUSEADDR, &iOne, sizeof(iOne));
+    if (bind(iListen, (struct sockaddr *)&sAddr, sizeof(sAddr)) != 0 || listen(iListen, 1) != 0)
+    {
+        close(iListen);
+        return NULL;
+    }
+
+    fprintf(stderr, "waiting for the controller on 127.0.0.1:%u\n", (unsigned)u16Port);
+    int iConn = accept(iListen, NULL, NULL);
+    close(iListen);
+
+    return (iConn < 0) ? NULL : fdopen(iConn, "w");
+}
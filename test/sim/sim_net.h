@@ -0,0 +1,10 @@
+#ifndef SIM_NET_H
+#define SIM_NET_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// listens on 127.0.0.1:u16Port and returns the stream of the first controller that connects
+FILE *Sim_psAcceptController(uint16_t u16Port);
+
+#endif // SIM_NET_H
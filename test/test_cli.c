@@ -317,6 +317,53 @@ void test_vCLI_ChangePassword(void)
 
 #ifdef MY_TRANSPORT_ERROR_LOG
 
+void test_vCLI_ConfigPatch(void)
+{
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13/S,o2,12/I,i1,16/"));
+    PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
+    CLI_T *psCli = (CLI_T *)psGlobals->ppsPresentables[0];
+    MyMessage *pcMsg = (MyMessage *)Memory_vpAlloc(sizeof(MyMessage));
+    const char *apcFragments[] = {
+        "#[240be518fabd272",
+        "4ddb6f04eeb1da5967448",
+        "d7e831c08c8fa822809f7",
+        "4c720a9/CMD:CFG_PATCH:",
+        "T,t1,i1,0,1,o2,0/-o1]#"};
+
+    for (uint8_t i = 0; i < sizeof(apcFragments) / sizeof(apcFragments[0]); i++)
+    {
+        memset(mock_send_message, 0, sizeof(mock_send_message));
+        strcpy(pcMsg->data, apcFragments[i]);
+        Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    }
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_CMD_DATA;Cfg patched.;", mock_send_message);
+
+    char acCfg[64];
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eLoadConfig(acCfg));
+    TEST_ASSERT_EQUAL_STRING("S,o2,12/I,i1,16/T,t1,i1,0,1,o2,0/", acCfg);
+
+    // a patch that breaks the config is not saved
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        strcpy(pcMsg->data, apcFragments[i]);
+        Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    }
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, "X,x1,1]#");
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_CMD_DATA;VALIDATION_ERROR;", mock_send_message);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eLoadConfig(acCfg));
+    TEST_ASSERT_EQUAL_STRING("S,o2,12/I,i1,16/T,t1,i1,0,1,o2,0/", acCfg);
+
+    // applied by the next loop
+    PinCfgCsv_vLoop(100);
+    TEST_ASSERT_EQUAL(3, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL_STRING("o2", Presentable_pcGetName(psGlobals->ppsPresentables[1]));
+    TEST_ASSERT_EQUAL(1, psGlobals->u16SwitchesCount);
+}
+
 void test_vCLI_GetTransportErrors_EmptyLog(void)
 {
     Memory_eReset();
@@ -394,11 +441,24 @@ void test_vCLI_GetTransportErrors_SingleEntry(void)
 
     // Clear mock before final fragment to capture only the response
     memset(mock_send_message, 0, sizeof(mock_send_message));
+    mock_wait_u32Called = 0;
     strcpy(pcMsg->data, "RORS]#");
     Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
 
-    // Final fragment sends state feedback, then message is split every 25 chars by Cli_vSendBigMessage, mock adds ;
-    // after each Full message: "T:3,C:3|1000,82,8,5|1100,83,8,0|1200,8B,8,10" (47 chars)
+    // Final fragment sends state feedback and the first 25 chars, the rest goes out from the loop
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_CMD_DATA;T:3,C:3|1000,82,8,5|1100,;", mock_send_message);
+    TEST_ASSERT_NOT_NULL(psCli->pcTxBuf);
+
+    uint32_t u32Time = mock_millis_u32Return;
+    psCli->sLoopable.vLoop(&psCli->sLoopable, u32Time + PINCFG_LONG_MESSAGE_DELAY_MS_D - 1);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_CMD_DATA;T:3,C:3|1000,82,8,5|1100,;", mock_send_message);
+    for (uint8_t i = 1; i <= 2; i++)
+        psCli->sLoopable.vLoop(&psCli->sLoopable, u32Time + i * PINCFG_LONG_MESSAGE_DELAY_MS_D);
+
+    // message is split every 25 chars by Cli_vSendBigMessage, mock adds ; after each
+    // Full message: "T:3,C:3|1000,82,8,5|1100,83,8,0|1200,8B,8,10" (47 chars)
+    TEST_ASSERT_NULL(psCli->pcTxBuf);
+    TEST_ASSERT_EQUAL(0, mock_wait_u32Called);
     TEST_ASSERT_EQUAL_STRING(
         "RECEIVING_CMD_DATA;T:3,C:3|1000,82,8,5|1100,;83,8,0|1200,8B,8,10;READY;", mock_send_message);
 }
@@ -477,11 +537,218 @@ void test_vCLI_GetTransportErrors_FullLog(void)
 
 #endif // MY_TRANSPORT_ERROR_LOG
 
+void test_vCLI_SequencedUpload(void)
+{
+    Memory_eReset();
+    PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
+
+    init_mock_EEPROM_with_default_password();
+    CLI_T *psCli = (CLI_T *)Memory_vpAlloc(sizeof(CLI_T));
+    Cli_eInit(psCli, 0);
+
+    MyMessage *pcMsg = (MyMessage *)Memory_vpAlloc(sizeof(MyMessage));
+    // "#[<pwd>/CMD:GET_CFG]#" in 22 char fragments, fragment 02 gets lost
+    const char *apcFragments[] = {
+        "~00#[240be518fabd2724ddb6",
+        "~01f04eeb1da5967448d7e831",
+        "~02c08c8fa822809f74c720a9",
+        "~03/CMD:GET_CFG]#"};
+
+    mock_millis_u32Return = 1000;
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, apcFragments[0]);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_NOT_NULL(psCli->pcSeqWin);
+    TEST_ASSERT_EQUAL(CLI_RECEIVING_AUTH_E, psCli->eState);
+    TEST_ASSERT_EQUAL(1, psCli->u8SeqNext);
+
+    strcpy(pcMsg->data, apcFragments[1]);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    strcpy(pcMsg->data, apcFragments[3]);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    // 03 held back until 02 arrives, no per fragment echo
+    TEST_ASSERT_EQUAL(2, psCli->u8SeqNext);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;", mock_send_message);
+
+    // sender goes quiet - node asks for what is missing
+    psCli->sLoopable.vLoop(&psCli->sLoopable, 1000 + PINCFG_CLI_SEQ_ACK_DELAY_MS_D - 1);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;", mock_send_message);
+    psCli->sLoopable.vLoop(&psCli->sLoopable, 1000 + PINCFG_CLI_SEQ_ACK_DELAY_MS_D);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;NAK:02;", mock_send_message);
+    // reported only once
+    psCli->sLoopable.vLoop(&psCli->sLoopable, 1000 + 2 * PINCFG_CLI_SEQ_ACK_DELAY_MS_D);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;NAK:02;", mock_send_message);
+
+    // duplicate of an already processed fragment is answered right away
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, apcFragments[1]);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_EQUAL_STRING("NAK:02;", mock_send_message);
+    TEST_ASSERT_EQUAL(CLI_RECEIVING_AUTH_E, psCli->eState);
+
+    // retransmitted fragment completes the command
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, apcFragments[2]);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_TYPE;RECEIVING_CMD_DATA;No config data.;", mock_send_message);
+    TEST_ASSERT_NULL(psCli->pcSeqWin);
+    TEST_ASSERT_NULL(psCli->pcCfgBuf);
+
+    // invalid sequence number
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, "~G0#[");
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_EQUAL_STRING("Invalid message format.;", mock_send_message);
+    TEST_ASSERT_NULL(psCli->pcSeqWin);
+}
+
+void test_vCLI_SequencedUpload_WindowAck(void)
+{
+    Memory_eReset();
+    PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
+
+    init_mock_EEPROM_with_default_password();
+    CLI_T *psCli = (CLI_T *)Memory_vpAlloc(sizeof(CLI_T));
+    Cli_eInit(psCli, 0);
+
+    MyMessage *pcMsg = (MyMessage *)Memory_vpAlloc(sizeof(MyMessage));
+    char acFragment[MAX_PAYLOAD_SIZE + 1];
+
+    // password and type, then command data padded with spaces over more than one window
+    const char *pcStart[] = {"#[240be518fabd2724ddb6", "f04eeb1da5967448d7e831", "c08c8fa822809f74c720a9",
+                             "/CMD:"};
+    mock_millis_u32Return = 1000;
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    uint8_t u8Seq = 0;
+    for (; u8Seq < 4; u8Seq++)
+    {
+        snprintf(acFragment, sizeof(acFragment), "~%02X%s", u8Seq, pcStart[u8Seq]);
+        strcpy(pcMsg->data, acFragment);
+        Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    }
+    TEST_ASSERT_EQUAL(CLI_RECEIVING_CMD_DATA_E, psCli->eState);
+
+    // last two fragments of the window swapped - ACK once the window is complete
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    for (; u8Seq < PINCFG_CLI_SEQ_WINDOW_D - 2; u8Seq++)
+    {
+        snprintf(acFragment, sizeof(acFragment), "~%02X ", u8Seq);
+        strcpy(pcMsg->data, acFragment);
+        Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    }
+    snprintf(acFragment, sizeof(acFragment), "~%02X ", PINCFG_CLI_SEQ_WINDOW_D - 1);
+    strcpy(pcMsg->data, acFragment);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_EQUAL_STRING("", mock_send_message);
+    snprintf(acFragment, sizeof(acFragment), "~%02X ", PINCFG_CLI_SEQ_WINDOW_D - 2);
+    strcpy(pcMsg->data, acFragment);
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+
+    char acExpected[16];
+    snprintf(acExpected, sizeof(acExpected), "ACK:%02X;", PINCFG_CLI_SEQ_WINDOW_D);
+    TEST_ASSERT_EQUAL_STRING(acExpected, mock_send_message);
+    TEST_ASSERT_EQUAL(PINCFG_CLI_SEQ_WINDOW_D, psCli->u8SeqNext);
+
+    // nothing lost - the idle report is an ACK as well, and the upload times out like a plain one
+    psCli->sLoopable.vLoop(&psCli->sLoopable, 1000 + PINCFG_CLI_RECEIVE_TIMEOUT_MS_D);
+    TEST_ASSERT_NULL(psCli->pcSeqWin);
+    TEST_ASSERT_EQUAL(CLI_READY_E, psCli->eState);
+}
+
+// upload that fails validation, its report goes out in chunks from the loop
+static CLI_T *psCLI_StartValidationErrorResponse(MyMessage **ppcMsg)
+{
+    Memory_eReset();
+    PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
+
+    init_mock_EEPROM_with_default_password();
+    CLI_T *psCli = (CLI_T *)Memory_vpAlloc(sizeof(CLI_T));
+    Cli_eInit(psCli, 0);
+
+    MyMessage *pcMsg = (MyMessage *)Memory_vpAlloc(sizeof(MyMessage));
+    *ppcMsg = pcMsg;
+    const char *apcFragments[] = {
+        "#[240be518fabd272",
+        "4ddb6f04eeb1da5967448",
+        "d7e831c08c8fa822809f7",
+        "4c720a9/CFG:X,x1,1/",
+        "Y,y1,1/Z,z1,1/V,v1,1/]#"};
+
+    mock_millis_u32Return = 1000;
+    for (uint8_t i = 0; i < sizeof(apcFragments) / sizeof(apcFragments[0]); i++)
+    {
+        memset(mock_send_message, 0, sizeof(mock_send_message));
+        strcpy(pcMsg->data, apcFragments[i]);
+        Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    }
+
+    return psCli;
+}
+
+void test_vCLI_ValidationErrorChunked(void)
+{
+    MyMessage *pcMsg = NULL;
+    CLI_T *psCli = psCLI_StartValidationErrorResponse(&pcMsg);
+
+    TEST_ASSERT_NOT_NULL(psCli->pcTxBuf);
+    size_t szReport = strlen(psCli->pcTxBuf);
+    TEST_ASSERT_TRUE(szReport > PINCFG_TXTSTATE_MAX_SZ_D);
+    TEST_ASSERT_EQUAL(0, strncmp("RECEIVING_CFG_DATA;", mock_send_message, 19));
+#ifndef USE_MALLOC
+    // only the report stays in the temporary region during the transfer
+    TEST_ASSERT_TRUE((size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd) <=
+                     Memory_szGetAllocatedSize(szReport + 1) + 2 * sizeof(void *));
+#endif
+
+    uint32_t u32Time = mock_millis_u32Return;
+    for (uint8_t i = 1; psCli->pcTxBuf != NULL && i < 100; i++)
+        psCli->sLoopable.vLoop(&psCli->sLoopable, u32Time + i * PINCFG_LONG_MESSAGE_DELAY_MS_D);
+
+    TEST_ASSERT_NULL(psCli->pcTxBuf);
+    const char *pcTail = "VALIDATION_ERROR;READY;";
+    size_t szSent = strlen(mock_send_message);
+    TEST_ASSERT_TRUE(szSent > strlen(pcTail));
+    TEST_ASSERT_EQUAL_STRING(pcTail, mock_send_message + szSent - strlen(pcTail));
+    TEST_ASSERT_EQUAL(CLI_READY_E, psCli->eState);
+#ifndef USE_MALLOC
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+#endif
+}
+
+void test_vCLI_NewTransactionAbortsResponse(void)
+{
+    MyMessage *pcMsg = NULL;
+    CLI_T *psCli = psCLI_StartValidationErrorResponse(&pcMsg);
+    TEST_ASSERT_NOT_NULL(psCli->pcTxBuf);
+
+    // the client starts over before the report is out
+    memset(mock_send_message, 0, sizeof(mock_send_message));
+    strcpy(pcMsg->data, "#[240be518fabd272");
+    Cli_vRcvMessage((PRESENTABLE_T *)psCli, pcMsg);
+    TEST_ASSERT_NULL(psCli->pcTxBuf);
+    TEST_ASSERT_EQUAL(CLI_RECEIVING_AUTH_E, psCli->eState);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;", mock_send_message);
+#ifndef USE_MALLOC
+    // the report is released, only the receive buffer is left
+    TEST_ASSERT_TRUE((size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd) <=
+                     Memory_szGetAllocatedSize(PINCFG_CONFIG_TEXT_MAX_SZ_D) + 2 * sizeof(void *));
+#endif
+
+    // no rest of the old report from the loop
+    psCli->sLoopable.vLoop(&psCli->sLoopable, mock_millis_u32Return + PINCFG_LONG_MESSAGE_DELAY_MS_D);
+    TEST_ASSERT_EQUAL_STRING("RECEIVING_AUTH;", mock_send_message);
+}
+
 void register_cli_tests(void)
 {
     RUN_TEST(test_vCLI);
     RUN_TEST(test_vCLI_EdgeCases);
     RUN_TEST(test_vCLI_ChangePassword);
+    RUN_TEST(test_vCLI_SequencedUpload);
+    RUN_TEST(test_vCLI_SequencedUpload_WindowAck);
+    RUN_TEST(test_vCLI_ConfigPatch);
+    RUN_TEST(test_vCLI_ValidationErrorChunked);
+    RUN_TEST(test_vCLI_NewTransactionAbortsResponse);
 #ifdef MY_TRANSPORT_ERROR_LOG
     RUN_TEST(test_vCLI_GetTransportErrors_EmptyLog);
     RUN_TEST(test_vCLI_GetTransportErrors_SingleEntry);
@@ -29,7 +29,7 @@ void test_vMySenosrsPresent(void)
 #endif // USE_MALLOC
     eResult = Presentable_eInit(psPresentHandle, &sName, 1);
     TEST_ASSERT_EQUAL_STRING(acName, psPresentHandle->pcName);
-    TEST_ASSERT_EQUAL_UINT8(1, psPresentHandle->u8Id);
+    TEST_ASSERT_EQUAL_UINT16(1, psPresentHandle->u16Id);
 
     Presentable_vSendState(psPresentHandle);
     TEST_ASSERT_EQUAL_UINT8(0, mock_MyMessage_set_uint8_t_value);
@@ -42,7 +42,7 @@ void test_vMySenosrsPresent(void)
     TEST_ASSERT_EQUAL_UINT8(0, mock_MyMessage_set_uint8_t_value);
     TEST_ASSERT_EQUAL(3, mock_send_u32Called);
 
-    TEST_ASSERT_EQUAL_UINT8(1U, Presentable_u8GetId(psPresentHandle));
+    TEST_ASSERT_EQUAL_UINT16(1U, Presentable_u16GetId(psPresentHandle));
 
     TEST_ASSERT_EQUAL_STRING(acName, Presentable_pcGetName(psPresentHandle));
 
@@ -61,6 +61,107 @@ void test_vMySenosrsPresent(void)
     TEST_ASSERT_EQUAL(1, mock_bRequest_u32Called);
 }
 
+void test_vLoopStats(void)
+{
+    char acOut[LOOPSTATS_TEXT_MAX_SZ];
+
+    // bucket b holds 2^(b-1) .. 2^b - 1 us
+    for (uint8_t i = 0; i < 98; i++)
+        LoopStats_vRecord(100);
+    LoopStats_vRecord(0);
+    LoopStats_vRecord(3000);
+    TEST_ASSERT_EQUAL(127, LoopStats_u32GetP99Us());
+    LoopStats_vRecord(5000);
+    TEST_ASSERT_EQUAL(4095, LoopStats_u32GetP99Us());
+
+    TEST_ASSERT_EQUAL(
+        strlen("N:101,MAX:5000,P99:4095,H:1,0,0,0,0,0,0,98,0,0,0,0,1,1"),
+        LoopStats_szReadAndReset(acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING("N:101,MAX:5000,P99:4095,H:1,0,0,0,0,0,0,98,0,0,0,0,1,1", acOut);
+
+    // cleared on read, a stall beyond the last bucket is reported by its maximum
+    LoopStats_szReadAndReset(acOut, sizeof(acOut));
+    TEST_ASSERT_EQUAL_STRING("N:0,MAX:0,P99:0,H:0", acOut);
+    LoopStats_vRecord(4000000UL);
+    TEST_ASSERT_EQUAL(4000000UL, LoopStats_u32GetP99Us());
+    TEST_ASSERT_EQUAL(1, psGlobals->au32LoopStatsHist[PINCFG_LOOPSTATS_BUCKETS_D - 1]);
+
+    // busy buckets keep counting past 16 bits, the rare slow loops stay below 1 %
+    LoopStats_vInit();
+    for (uint32_t i = 0; i < 200000UL; i++)
+        LoopStats_vRecord(100);
+    for (uint16_t i = 0; i < 1500; i++)
+        LoopStats_vRecord(5000);
+    TEST_ASSERT_EQUAL(200000UL, psGlobals->au32LoopStatsHist[7]);
+    TEST_ASSERT_EQUAL(127, LoopStats_u32GetP99Us());
+
+    // every loop pass is recorded
+    LoopStats_vInit();
+    mock_micros_u32Return = 0;
+    PinCfgCsv_vLoop(10);
+    PinCfgCsv_vLoop(20);
+    TEST_ASSERT_EQUAL(2, psGlobals->u32LoopStatsCount);
+    TEST_ASSERT_EQUAL(2, psGlobals->au32LoopStatsHist[0]);
+}
+
+void test_vSendQueue(void)
+{
+    char acName[] = "q";
+    STRING_POINT_T sName;
+    PinCfgStr_vInitStrPoint(&sName, acName, sizeof(acName) - 1);
+    PRESENTABLE_T asPresentables[PINCFG_SEND_QUEUE_BURST_D + 2];
+    for (uint8_t i = 0; i < PINCFG_SEND_QUEUE_BURST_D + 2; i++)
+    {
+        TEST_ASSERT_EQUAL(PRESENTABLE_OK_E, Presentable_eInit(&asPresentables[i], &sName, i + 1));
+        asPresentables[i].psVtab = &psGlobals->sSwitchPrVTab;
+        asPresentables[i].ePayloadType = P_ULONG32; // mock keeps the value only for wide payloads
+    }
+
+    mock_millis_u32Return = 1000;
+    vSendQueueInit(&psGlobals->sSendQueue);
+
+    // burst goes out immediately, the rest waits
+    for (uint8_t i = 0; i < PINCFG_SEND_QUEUE_BURST_D + 2; i++)
+        Presentable_vSetState(&asPresentables[i], 1, true);
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D, mock_send_u32Called);
+    TEST_ASSERT_EQUAL(2, u8SendQueueGetCount(&psGlobals->sSendQueue));
+
+    // pending update of the same child is replaced, not appended
+    Presentable_vSetState(&asPresentables[PINCFG_SEND_QUEUE_BURST_D + 1], 0, true);
+    TEST_ASSERT_EQUAL(2, u8SendQueueGetCount(&psGlobals->sSendQueue));
+
+    // direct sends bypass the queue
+    Presentable_vSendState(&asPresentables[0]);
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D + 1, mock_send_u32Called);
+
+    vSendQueueLoop(&psGlobals->sSendQueue, 1000 + PINCFG_SEND_QUEUE_INTERVAL_MS_D - 1);
+    TEST_ASSERT_EQUAL(2, u8SendQueueGetCount(&psGlobals->sSendQueue));
+
+    vSendQueueLoop(&psGlobals->sSendQueue, 1000 + PINCFG_SEND_QUEUE_INTERVAL_MS_D);
+    TEST_ASSERT_EQUAL(1, u8SendQueueGetCount(&psGlobals->sSendQueue));
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D + 1, mock_send_msg.sensor);
+    TEST_ASSERT_EQUAL(1, mock_send_msg.ulValue);
+
+    vSendQueueLoop(&psGlobals->sSendQueue, 1000 + 2 * PINCFG_SEND_QUEUE_INTERVAL_MS_D);
+    TEST_ASSERT_EQUAL(0, u8SendQueueGetCount(&psGlobals->sSendQueue));
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D + 2, mock_send_msg.sensor);
+    TEST_ASSERT_EQUAL(0, mock_send_msg.ulValue);
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D + 3, mock_send_u32Called);
+
+    // full queue flushes its oldest entry rather than dropping a state change
+    mock_send_u32Called = 0;
+    for (uint8_t i = 0; i < PINCFG_SEND_QUEUE_BURST_D; i++)
+        Presentable_vSetState(&asPresentables[0], i, true);
+    for (uint8_t i = 0; i < PINCFG_SEND_QUEUE_SZ_D + 1; i++)
+    {
+        asPresentables[1].u16Id = 10 + i;
+        Presentable_vSetState(&asPresentables[1], i, true);
+    }
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_SZ_D, u8SendQueueGetCount(&psGlobals->sSendQueue));
+    TEST_ASSERT_EQUAL(PINCFG_SEND_QUEUE_BURST_D + 1, mock_send_u32Called);
+    TEST_ASSERT_EQUAL(10, mock_send_msg.sensor);
+}
+
 void test_vInPin(void)
 {
     char acName[] = "InPin";
@@ -107,7 +208,6 @@ void test_vInPin(void)
 void test_vSwitch(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -122,8 +222,8 @@ void test_vSwitch(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -132,15 +232,11 @@ void test_vSwitch(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    TEST_ASSERT_EQUAL(7, psGlobals->u8LoopablesCount);
+    // switches are looped from their own array, only the CLI is a loopable
+    TEST_ASSERT_EQUAL(1, psGlobals->u16LoopablesCount);
+    TEST_ASSERT_EQUAL(6, psGlobals->u16SwitchesCount);
 
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    TEST_ASSERT_EQUAL(7, psGlobals->u8PresentablesCount);
+    TEST_ASSERT_EQUAL(7, psGlobals->u16PresentablesCount);
 
     PRESENTABLE_T *psPresentable = (PRESENTABLE_T *)psGlobals->ppsPresentables[0];
     TEST_ASSERT_EQUAL_STRING("CLI", psPresentable->pcName);
@@ -186,7 +282,6 @@ void test_vSwitch(void)
 void test_vTrigger(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -197,8 +292,8 @@ void test_vTrigger(void)
     // Setup parse params
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -207,15 +302,9 @@ void test_vTrigger(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    TEST_ASSERT_EQUAL(3, psGlobals->u8LoopablesCount);
+    TEST_ASSERT_EQUAL(1, psGlobals->u16LoopablesCount);
 
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    TEST_ASSERT_EQUAL(3, psGlobals->u8PresentablesCount);
+    TEST_ASSERT_EQUAL(3, psGlobals->u16PresentablesCount);
 
     INPIN_T *psInPin = (INPIN_T *)psGlobals->ppsPresentables[1];
     SWITCH_T *psSwitch = (SWITCH_T *)psGlobals->ppsPresentables[2];
@@ -264,10 +353,109 @@ void test_vTrigger(void)
     // TEST_ASSERT_EQUAL(2, psSwitch->u8State);
 }
 
+void test_vCompositeTrigger(void)
+{
+    PINCFG_RESULT_T eParseResult;
+    char acOutStr[OUT_STR_MAX_LEN_D];
+    size_t szMemoryRequired;
+
+    // c1: i1 UP and i2 value < 50 -> o1 on
+    // c2: i1 not UP for 1000 ms -> o1 off
+    const char *pcCfg = "I,i1,16,i2,17/"
+                        "S,o1,13/"
+                        "TC,c1,0,0,2,i1,1,0,i2,6,50,o1,1/"
+                        "TC,c2,0,1000,1,!i1,1,0,o1,2/";
+
+    PINCFG_PARSE_PARAMS_T sParams = {
+        .pcConfig = pcCfg,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
+        .pszMemoryRequired = &szMemoryRequired,
+        .pcOutString = acOutStr,
+        .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
+        .bValidate = false};
+
+    eParseResult = PinCfgCsv_eParse(&sParams);
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
+
+    // only the composite trigger with hold time is loopable
+    TEST_ASSERT_EQUAL(2, psGlobals->u16LoopablesCount);
+    TEST_ASSERT_EQUAL(4, psGlobals->u16PresentablesCount);
+
+    IEVENTPUBLISHER_T *psIn1 = (IEVENTPUBLISHER_T *)psGlobals->ppsPresentables[1];
+    IEVENTPUBLISHER_T *psIn2 = (IEVENTPUBLISHER_T *)psGlobals->ppsPresentables[2];
+    SWITCH_T *psSwitch = (SWITCH_T *)psGlobals->ppsPresentables[3];
+    LOOPABLE_T *psHoldLoopable = psGlobals->ppsLoopables[1];
+
+    COMPOSITETRIGGER_CONDITION_T *psCond = (COMPOSITETRIGGER_CONDITION_T *)psIn1->psFirstSubscriber;
+    TEST_ASSERT_NOT_NULL(psCond);
+    COMPOSITETRIGGER_T *psC1 = psCond->psParent;
+    TEST_ASSERT_EQUAL(2, psC1->u8ConditionsCount);
+    TEST_ASSERT_EQUAL(COMPOSITETRIGGER_AND_E, psC1->eOperator);
+    TEST_ASSERT_EQUAL(50 * PINCFG_FIXED_POINT_SCALE, psC1->pasConditions[1].i32EventData);
+    TEST_ASSERT_FALSE(psC1->bResult);
+
+    // negated condition holds from the start but must not fire on init
+    COMPOSITETRIGGER_T *psC2 = ((COMPOSITETRIGGER_CONDITION_T *)psCond->sEventSubscriber.psNext)->psParent;
+    TEST_ASSERT_TRUE(psC2->bResult);
+    TEST_ASSERT_TRUE(psC2->pasConditions[0].bNegate);
+    TEST_ASSERT_EQUAL(0, psSwitch->sPresentable.u8State);
+
+    // one condition alone is not enough
+    EventPublisher_vSendEvent(psIn2, TRIGGER_VALUE_E, 40 * PINCFG_FIXED_POINT_SCALE, 0);
+    TEST_ASSERT_EQUAL(0, psSwitch->sPresentable.u8State);
+
+    EventPublisher_vSendEvent(psIn1, TRIGGER_UP_E, 0, 10);
+    TEST_ASSERT_TRUE(psC1->bResult);
+    TEST_ASSERT_EQUAL(1, psSwitch->sPresentable.u8State);
+
+    // hold window starts when i1 is released
+    EventPublisher_vSendEvent(psIn1, TRIGGER_DOWN_E, 0, 20);
+    TEST_ASSERT_FALSE(psC1->bResult);
+    psHoldLoopable->vLoop(psHoldLoopable, 500);
+    TEST_ASSERT_EQUAL(1, psSwitch->sPresentable.u8State);
+    psHoldLoopable->vLoop(psHoldLoopable, 1020);
+    TEST_ASSERT_EQUAL(0, psSwitch->sPresentable.u8State);
+
+    // repeated true state does not retrigger
+    Presentable_vSetState((PRESENTABLE_T *)psSwitch, 1, false);
+    psHoldLoopable->vLoop(psHoldLoopable, 3000);
+    TEST_ASSERT_EQUAL(1, psSwitch->sPresentable.u8State);
+
+    // value above threshold blocks c1
+    Presentable_vSetState((PRESENTABLE_T *)psSwitch, 0, false);
+    EventPublisher_vSendEvent(psIn2, TRIGGER_VALUE_E, 60 * PINCFG_FIXED_POINT_SCALE, 3010);
+    EventPublisher_vSendEvent(psIn1, TRIGGER_UP_E, 0, 3020);
+    TEST_ASSERT_FALSE(psC1->bResult);
+    TEST_ASSERT_EQUAL(0, psSwitch->sPresentable.u8State);
+
+    // i1 pressed again before hold time elapsed restarts the window
+    EventPublisher_vSendEvent(psIn1, TRIGGER_DOWN_E, 0, 3030);
+    EventPublisher_vSendEvent(psIn1, TRIGGER_UP_E, 0, 3500);
+    EventPublisher_vSendEvent(psIn1, TRIGGER_DOWN_E, 0, 3600);
+    Presentable_vSetState((PRESENTABLE_T *)psSwitch, 1, false);
+    psHoldLoopable->vLoop(psHoldLoopable, 4100);
+    TEST_ASSERT_EQUAL(1, psSwitch->sPresentable.u8State);
+    psHoldLoopable->vLoop(psHoldLoopable, 4600);
+    TEST_ASSERT_EQUAL(0, psSwitch->sPresentable.u8State);
+
+    // invalid definitions are reported as warnings
+    TEST_ASSERT_EQUAL(
+        PINCFG_WARNINGS_E, PinCfgCsv_eValidate("I,i1,16/S,o1,13/TC,c1,2,0,1,i1,1,0,o1,1/", NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(
+        PINCFG_WARNINGS_E, PinCfgCsv_eValidate("I,i1,16/S,o1,13/TC,c1,0,0,2,i1,1,0,o1,1/", NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(
+        PINCFG_WARNINGS_E, PinCfgCsv_eValidate("I,i1,16/S,o1,13/TC,c1,0,0,1,i1,9,0,o1,1/", NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eValidate("I,i1,16/S,o1,13/TC,c1,1,0,1,!i1,1,0,o1,1/", NULL, NULL, 0));
+}
+
 void register_components_tests(void)
 {
     RUN_TEST(test_vMySenosrsPresent);
+    RUN_TEST(test_vLoopStats);
+    RUN_TEST(test_vSendQueue);
     RUN_TEST(test_vInPin);
     RUN_TEST(test_vSwitch);
     RUN_TEST(test_vTrigger);
+    RUN_TEST(test_vCompositeTrigger);
 }
@@ -110,6 +110,181 @@ void test_vMemory(void)
 #endif // USE_MALLOC
 }
 
+void test_vMemoryNames(void)
+{
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eInit(testMemory, MEMORY_SZ));
+    size_t szFree = Memory_szGetFree();
+
+    // short names share a chunk back to back
+    char *pcName1 = Memory_pcNameAlloc(2);
+    char *pcName2 = Memory_pcNameAlloc(5);
+    char *pcName3 = Memory_pcNameAlloc(1);
+    TEST_ASSERT_NOT_NULL(pcName1);
+    TEST_ASSERT_EQUAL(pcName1 + 3, pcName2);
+    TEST_ASSERT_EQUAL(pcName2 + 6, pcName3);
+#ifndef USE_MALLOC
+    TEST_ASSERT_EQUAL(szFree - Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D), Memory_szGetFree());
+#endif // USE_MALLOC
+
+    // a name that does not fit the rest of the chunk opens a new one
+    char *pcName4 = Memory_pcNameAlloc(PINCFG_NAME_CHUNK_SZ_D - 8);
+    TEST_ASSERT_NOT_NULL(pcName4);
+    TEST_ASSERT_TRUE(pcName4 < pcName1 || pcName4 >= pcName1 + PINCFG_NAME_CHUNK_SZ_D);
+    char *pcName5 = Memory_pcNameAlloc(2);
+    TEST_ASSERT_EQUAL(pcName4 + PINCFG_NAME_CHUNK_SZ_D - 7, pcName5);
+
+    // names longer than a chunk get their own allocation and leave the chunk alone
+    char *pcLong = Memory_pcNameAlloc(PINCFG_NAME_CHUNK_SZ_D);
+    TEST_ASSERT_NOT_NULL(pcLong);
+    TEST_ASSERT_EQUAL(pcName5 + 3, Memory_pcNameAlloc(0));
+    (void)szFree;
+
+    // memory calculation follows the same packing
+    size_t szChunkLeft = 0;
+    size_t szRequired = Memory_szGetNameAllocatedSize(2, &szChunkLeft) + Memory_szGetNameAllocatedSize(5, &szChunkLeft) +
+                        Memory_szGetNameAllocatedSize(1, &szChunkLeft);
+    TEST_ASSERT_EQUAL(Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D), szRequired);
+    TEST_ASSERT_EQUAL(PINCFG_NAME_CHUNK_SZ_D - 11, szChunkLeft);
+    TEST_ASSERT_EQUAL(
+        Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D),
+        Memory_szGetNameAllocatedSize(PINCFG_NAME_CHUNK_SZ_D - 8, &szChunkLeft));
+    TEST_ASSERT_EQUAL(
+        Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D + 1),
+        Memory_szGetNameAllocatedSize(PINCFG_NAME_CHUNK_SZ_D, &szChunkLeft));
+    TEST_ASSERT_EQUAL(7, szChunkLeft);
+}
+
+void test_vMemoryTempFreeList(void)
+{
+#ifndef USE_MALLOC
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eInit(testMemory, MEMORY_SZ));
+    size_t szBlock = Memory_szGetAllocatedSize(40 + sizeof(void *));
+
+    char *pcA = (char *)Memory_vpTempAlloc(40);
+    char *pcB = (char *)Memory_vpTempAlloc(40);
+    char *pcC = (char *)Memory_vpTempAlloc(40);
+    TEST_ASSERT_NOT_NULL(pcC);
+    char *pcTempEnd = psGlobals->pvMemTempEnd;
+
+    // a block freed out of order is reused in place
+    strcpy(pcB, "secret");
+    Memory_vTempFreePt(pcB);
+    TEST_ASSERT_EQUAL(pcTempEnd, psGlobals->pvMemTempEnd);
+    TEST_ASSERT_EQUAL_STRING("", pcB);
+    TEST_ASSERT_EQUAL(pcB, Memory_vpTempAlloc(40));
+    TEST_ASSERT_EQUAL(pcTempEnd, psGlobals->pvMemTempEnd);
+
+    // neighbours merge, the merged block takes a bigger allocation
+    Memory_vTempFreePt(pcB);
+    Memory_vTempFreePt(pcA);
+    char *pcAB = (char *)Memory_vpTempAlloc(2 * szBlock - sizeof(void *));
+    TEST_ASSERT_EQUAL(pcB, pcAB);
+    TEST_ASSERT_EQUAL(pcTempEnd, psGlobals->pvMemTempEnd);
+
+    // a smaller one splits it, the upper part is taken
+    Memory_vTempFreePt(pcAB);
+    TEST_ASSERT_EQUAL(pcA, Memory_vpTempAlloc(40));
+    TEST_ASSERT_EQUAL(pcB, Memory_vpTempAlloc(40));
+
+    // freeing the lowest block gives back everything free above it
+    Memory_vTempFreePt(pcA);
+    Memory_vTempFreePt(pcB);
+    TEST_ASSERT_EQUAL(pcTempEnd, psGlobals->pvMemTempEnd);
+    Memory_vTempFreePt(pcC);
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+
+    // rolling buffers, each freed after the next one is allocated, do not grow the region
+    char *pcOld = (char *)Memory_vpTempAlloc(64);
+    for (int i = 0; i < 1000; i++)
+    {
+        char *pcNew = (char *)Memory_vpTempAlloc(64);
+        TEST_ASSERT_NOT_NULL(pcNew);
+        Memory_vTempFreePt(pcOld);
+        pcOld = pcNew;
+    }
+    TEST_ASSERT_TRUE((size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd) <= 2 * (64 + 2 * sizeof(void *)));
+    Memory_vTempFreePt(pcOld);
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+
+    // a shrunk block gives its end to the next allocation
+    pcA = (char *)Memory_vpTempAlloc(200);
+    pcB = (char *)Memory_vpTempAlloc(200);
+    strcpy(pcA, "upper");
+    strcpy(pcB, "lowest");
+    TEST_ASSERT_TRUE(Memory_vpTempShrink(pcA, 6) == pcA);
+    TEST_ASSERT_EQUAL_STRING("upper", pcA);
+    pcC = (char *)Memory_vpTempAlloc(100);
+    TEST_ASSERT_TRUE(pcC > pcA && pcC < pcA + 200);
+    Memory_vTempFreePt(pcC);
+
+    // the lowest one moves up, the rest goes back to the gap
+    size_t szFree = Memory_szGetFree();
+    char *pcMoved = (char *)Memory_vpTempShrink(pcB, 7);
+    TEST_ASSERT_TRUE(pcMoved > pcB);
+    TEST_ASSERT_EQUAL_STRING("lowest", pcMoved);
+    TEST_ASSERT_EQUAL(szFree + (size_t)(pcMoved - pcB), Memory_szGetFree());
+    Memory_vTempFreePt(pcMoved);
+    Memory_vTempFreePt(pcA);
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+#endif // USE_MALLOC
+}
+
+void test_vMemoryStats(void)
+{
+#if PINCFG_MEMSTATS_D
+    char acOut[MEMORY_STATS_TEXT_MAX_SZ];
+    char acExpected[32];
+
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(
+        PINCFG_OK_E,
+        PinCfgCsv_eInit(
+            testMemory,
+            MEMORY_SZ,
+            "MS,0,cpu/SR,temp,cpu,6,6,0,0,1000,60,1.0/S,o1,13,o2,12/I,i1,16/T,t1,i1,0,0,o1,0/"));
+
+    TEST_ASSERT_EQUAL(Memory_szGetAllocatedSize(sizeof(SWITCH_T) * 2), Memory_szGetTagged(MEMORY_TAG_SWITCH_E));
+    TEST_ASSERT_EQUAL(Memory_szGetAllocatedSize(sizeof(INPIN_T)), Memory_szGetTagged(MEMORY_TAG_INPUT_E));
+    TEST_ASSERT_EQUAL(
+        Memory_szGetAllocatedSize(sizeof(TRIGGER_T)) + Memory_szGetAllocatedSize(sizeof(TRIGGER_SWITCHACTION_T)),
+        Memory_szGetTagged(MEMORY_TAG_TRIGGER_E));
+    TEST_ASSERT_TRUE(Memory_szGetTagged(MEMORY_TAG_SENSOR_E) >= Memory_szGetAllocatedSize(sizeof(SENSOR_T)));
+    TEST_ASSERT_TRUE(Memory_szGetTagged(MEMORY_TAG_NAMES_E) >= Memory_szGetAllocatedSize(PINCFG_NAME_CHUNK_SZ_D));
+    TEST_ASSERT_TRUE(Memory_szGetTagged(MEMORY_TAG_ARRAYS_E) > 0);
+    TEST_ASSERT_EQUAL(Memory_szGetAllocatedSize(sizeof(CLI_T)), Memory_szGetTagged(MEMORY_TAG_OTHER_E));
+
+    size_t szUsed = 0;
+    for (uint8_t i = 0; i < MEMORY_TAG_COUNT_E; i++)
+        szUsed += Memory_szGetTagged((MEMORY_TAG_T)i);
+#ifndef USE_MALLOC
+    // every permanent byte is accounted to a type
+    TEST_ASSERT_EQUAL((size_t)(psGlobals->pvMemNext - ((char *)psGlobals + sizeof(GLOBALS_T))), szUsed);
+
+    // temp high-water mark stays after the free
+    size_t szFree = Memory_szGetFree();
+    void *pvTmp = Memory_vpTempAlloc(100);
+    TEST_ASSERT_NOT_NULL(pvTmp);
+    size_t szTempMax = (size_t)(psGlobals->pvMemEnd - psGlobals->pvMemTempEnd);
+    Memory_vTempFreePt(pvTmp);
+    TEST_ASSERT_EQUAL(szFree, Memory_szGetFree());
+    TEST_ASSERT_EQUAL(szTempMax, psGlobals->szMemTempMax);
+    TEST_ASSERT_EQUAL(szFree - szTempMax, psGlobals->szMemFreeMin);
+#endif // USE_MALLOC
+
+    TEST_ASSERT_TRUE(Memory_szFormatStats(acOut, sizeof(acOut)) < sizeof(acOut));
+    snprintf(acExpected, sizeof(acExpected), "USED:%lu,", (unsigned long)szUsed);
+    TEST_ASSERT_EQUAL(0, strncmp(acExpected, acOut, strlen(acExpected)));
+    snprintf(acExpected, sizeof(acExpected), ",SW:%lu,", (unsigned long)Memory_szGetTagged(MEMORY_TAG_SWITCH_E));
+    TEST_ASSERT_NOT_NULL(strstr(acOut, acExpected));
+
+    // a new generation starts from zero
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eResetPermanent());
+    TEST_ASSERT_EQUAL(0, Memory_szGetTagged(MEMORY_TAG_SWITCH_E));
+#else
+    TEST_PASS();
+#endif
+}
+
 void test_vStringPoint(void)
 {
     char acName[] = "Ahoj";
@@ -339,6 +514,9 @@ void test_vFixedPointParser(void)
 void register_core_tests(void)
 {
     RUN_TEST(test_vMemory);
+    RUN_TEST(test_vMemoryNames);
+    RUN_TEST(test_vMemoryTempFreeList);
+    RUN_TEST(test_vMemoryStats);
     RUN_TEST(test_vStringPoint);
     RUN_TEST(test_vLinkedList);
     RUN_TEST(test_vPinCfgStr);
@@ -175,8 +175,8 @@ void test_vSwitch_EdgeCases(void)
     PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -230,13 +230,7 @@ void test_vSwitch_EdgeCases(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     // Note: Zero delay triggers "Invalid time period" warning
     TEST_ASSERT_TRUE(eParseResult == PINCFG_OK_E || eParseResult == PINCFG_WARNINGS_E);
-    // Convert linked lists to arrays
-    LINKEDLIST_RESULT_T eLinkedListResult;
     SWITCH_T *psSwitch;
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
     if (eParseResult == PINCFG_OK_E)
     {
         psSwitch = (SWITCH_T *)psGlobals->ppsPresentables[1];
@@ -259,10 +253,6 @@ void test_vSwitch_EdgeCases(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
     psSwitch = (SWITCH_T *)psGlobals->ppsPresentables[1];
     TEST_ASSERT_EQUAL(13, psSwitch->u8OutPin);
     TEST_ASSERT_EQUAL(13, psSwitch->u8FbPin);
@@ -285,8 +275,8 @@ void test_vInPin_EdgeCases(void)
     PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -302,20 +292,11 @@ void test_vInPin_EdgeCases(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    // Convert linked lists to arrays
-    LINKEDLIST_RESULT_T eLinkedListResult;
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     // Verify input pin was created (may have CLI at index 0)
-    TEST_ASSERT_TRUE(psGlobals->u8PresentablesCount >= 1);
+    TEST_ASSERT_TRUE(psGlobals->u16PresentablesCount >= 1);
     // Find the input pin (might not be at index 0 if CLI exists)
     INPIN_T *psInPin = NULL;
-    for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
+    for (uint8_t i = 0; i < psGlobals->u16PresentablesCount; i++)
     {
         if (strcmp(psGlobals->ppsPresentables[i]->pcName, "i1") == 0)
         {
@@ -347,8 +328,8 @@ void test_vTrigger_EdgeCases(void)
     PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -391,15 +372,6 @@ void test_vTrigger_EdgeCases(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    // Convert linked lists to arrays
-    LINKEDLIST_RESULT_T eLinkedListResult;
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     INPIN_T *psInPin = (INPIN_T *)psGlobals->ppsPresentables[1];
     TRIGGER_T *psTrigger = (TRIGGER_T *)psInPin->psFirstSubscriber;
     TEST_ASSERT_EQUAL(2, psTrigger->u8SwActCount);
@@ -434,8 +406,8 @@ void test_vPinCfgCsv_EdgeCases(void)
     PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL);
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -498,12 +470,11 @@ void test_vCPUTemp_EdgeCases(void)
     PINCFG_RESULT_T eResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     SENSOR_T *psSensor = NULL;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -525,15 +496,9 @@ void test_vCPUTemp_EdgeCases(void)
 
         if (eResult == PINCFG_OK_E)
         {
-            // Convert linked lists to arrays
-            eLinkedListResult = LinkedList_eLinkedListToArray(
-                (LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-            eLinkedListResult = LinkedList_eLinkedListToArray(
-                (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
             // Find the sensor (accounting for CLI entries at [0] and [1])
             psSensor = NULL;
-            for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
+            for (uint8_t i = 0; i < psGlobals->u16PresentablesCount; i++)
             {
                 if (strstr(psGlobals->ppsPresentables[i]->pcName, "temp_sensor") != NULL)
                 {
@@ -564,15 +529,9 @@ void test_vCPUTemp_EdgeCases(void)
         eResult = PinCfgCsv_eParse(&sParams);
         TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-        // Convert linked lists to arrays
-        eLinkedListResult = LinkedList_eLinkedListToArray(
-            (LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-        eLinkedListResult = LinkedList_eLinkedListToArray(
-            (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
         // Find the sensor
         psSensor = NULL;
-        for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
+        for (uint8_t i = 0; i < psGlobals->u16PresentablesCount; i++)
         {
             if (strstr(psGlobals->ppsPresentables[i]->pcName, "temp_sensor2") != NULL)
             {
@@ -605,15 +564,9 @@ void test_vCPUTemp_EdgeCases(void)
 
         if (eResult == PINCFG_OK_E)
         {
-            // Convert linked lists to arrays
-            eLinkedListResult = LinkedList_eLinkedListToArray(
-                (LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-            eLinkedListResult = LinkedList_eLinkedListToArray(
-                (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
             // Find the sensor (accounting for CLI entries)
             psSensor = NULL;
-            for (uint8_t i = 0; i < psGlobals->u8PresentablesCount; i++)
+            for (uint8_t i = 0; i < psGlobals->u16PresentablesCount; i++)
             {
                 if (strstr(psGlobals->ppsPresentables[i]->pcName, "temp_sensor3") != NULL)
                 {
@@ -11,9 +11,11 @@
 #include "CPUTempMeasure.h"
 #include "Cli.h"
 #include "CliAuth.h"
+#include "CompositeTrigger.h"
 #include "Globals.h"
 #include "InPin.h"
 #include "LinkedList.h"
+#include "LoopStats.h"
 #ifdef PINCFG_FEATURE_LOOPTIME_MEASUREMENT
 #include "LoopTimeMeasure.h"
 #endif
@@ -23,9 +25,11 @@
 #include "PinCfgCsv.h"
 #include "PinCfgStr.h"
 #include "PinCfgUtils.h"
+#include "Profiler.h"
 #include "Presentable.h"
 #include "Sensor.h"
 #include "Switch.h"
+#include "Trace.h"
 #include "Trigger.h"
 
 #ifdef PINCFG_FEATURE_I2C_MEASUREMENT
@@ -46,6 +50,9 @@
 #ifndef MEMORY_SZ
 #ifdef USE_MALLOC
 #define MEMORY_SZ 3003
+#elif PINCFG_PROFILER_D
+// the profiler adds an entry per loopable, input and switch
+#define MEMORY_SZ 6000
 #else
 // Need more memory for static allocation mode (more complex tests)
 #define MEMORY_SZ 5000
@@ -22,7 +22,7 @@ void test_vFlow_timedSwitch(void)
 
     eResult = PinCfgCsv_eInit(testMemory, MEMORY_SZ, pcCfg);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
-    TEST_ASSERT_EQUAL(3, psGlobals->u8LoopablesCount);
+    TEST_ASSERT_EQUAL(1, psGlobals->u16LoopablesCount);
 
     // Verify CLI setup
     PRESENTABLE_T *psCLI = (PRESENTABLE_T *)psGlobals->ppsPresentables[0];
@@ -296,8 +296,8 @@ void test_vIntegration_CompleteSystem(void)
     TEST_ASSERT_EQUAL(120, psGlobals->u32SwitchImpulseDurationMs);
 
     // Verify components created (should have CLI + switches + inputs)
-    TEST_ASSERT_TRUE(psGlobals->u8PresentablesCount >= 6); // At least CLI + some components
-    TEST_ASSERT_TRUE(psGlobals->u8LoopablesCount >= 1);    // At least one loopable
+    TEST_ASSERT_TRUE(psGlobals->u16PresentablesCount >= 6); // At least CLI + some components
+    TEST_ASSERT_TRUE(psGlobals->u16LoopablesCount >= 1);    // At least one loopable
 
     // Run few loop iterations to ensure no crashes
     mock_millis_u32Return = 0;
@@ -312,6 +312,46 @@ void test_vIntegration_CompleteSystem(void)
 #endif
 }
 
+void test_vIntegration_PacedPresentation(void)
+{
+    init_mock_EEPROM_with_default_password();
+    const char *pcCfg = "S,o1,13,o2,12/"
+                        "I,i1,16/";
+
+    PINCFG_RESULT_T eResult = PinCfgCsv_eInit(testMemory, MEMORY_SZ, pcCfg);
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
+    uint8_t u8Count = psGlobals->u16PresentablesCount;
+    TEST_ASSERT_TRUE(u8Count >= 3);
+
+    mock_millis_u32Return = 1000;
+    mock_bPresent_u32Called = 0;
+    mock_wait_u32Called = 0;
+    PinCfgCsv_vPresentation();
+    // first item right away, the rest paced from the loop
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+    TEST_ASSERT_FALSE(PinCfgCsv_bPresentationDone());
+
+    PinCfgCsv_vLoop(1000 + PINCFG_PRESENTATION_INTERVAL_MS_D - 1);
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+
+    uint32_t u32Time = 1000;
+    for (uint8_t i = 1; i < u8Count; i++)
+    {
+        u32Time += PINCFG_PRESENTATION_INTERVAL_MS_D;
+        PinCfgCsv_vLoop(u32Time);
+        TEST_ASSERT_EQUAL(i + 1, mock_bPresent_u32Called);
+    }
+
+    u32Time += PINCFG_PRESENTATION_INTERVAL_MS_D;
+    PinCfgCsv_vLoop(u32Time);
+    TEST_ASSERT_EQUAL(u8Count, mock_bPresent_u32Called);
+#ifndef MY_CONTROLLER_HA
+    TEST_ASSERT_TRUE(PinCfgCsv_bPresentationDone());
+#endif
+    // the loop never blocks
+    TEST_ASSERT_EQUAL(0, mock_wait_u32Called);
+}
+
 void test_vIntegration_MemoryExhaustion(void)
 {
 #ifndef USE_MALLOC
@@ -342,9 +382,315 @@ void test_vIntegration_MemoryExhaustion(void)
 #endif
 }
 
+static PRESENTABLE_T *psFindPresentable(const char *pcName)
+{
+    for (uint8_t i = 0; i < psGlobals->u16PresentablesCount; i++)
+    {
+        if (strcmp(Presentable_pcGetName(psGlobals->ppsPresentables[i]), pcName) == 0)
+            return psGlobals->ppsPresentables[i];
+    }
+    return NULL;
+}
+
+void test_vIntegration_StateJournal(void)
+{
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,12/SI,imp,11/"));
+
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL));
+    PRESENTABLE_T *psO2 = psFindPresentable("o2");
+    PRESENTABLE_T *psImp = psFindPresentable("imp");
+    TEST_ASSERT_NOT_NULL(psO2);
+    TEST_ASSERT_NOT_NULL(psImp);
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psO2));
+
+    // changes are written once, PINCFG_STATE_JOURNAL_DELAY_MS_D after the first one
+    mock_millis_u32Return = 1000;
+    Presentable_vSetState(psO2, 1, false);
+    Presentable_vSetState(psImp, 1, false);
+    mock_hwWriteConfigBlock_u32Called = 0;
+    PinCfgCsv_vLoop(1000 + PINCFG_STATE_JOURNAL_DELAY_MS_D - 1);
+    TEST_ASSERT_EQUAL(0, mock_hwWriteConfigBlock_u32Called);
+    PinCfgCsv_vLoop(1000 + PINCFG_STATE_JOURNAL_DELAY_MS_D);
+    TEST_ASSERT_EQUAL(1, mock_hwWriteConfigBlock_u32Called);
+    PinCfgCsv_vLoop(1000 + 2 * PINCFG_STATE_JOURNAL_DELAY_MS_D);
+    TEST_ASSERT_EQUAL(1, mock_hwWriteConfigBlock_u32Called);
+
+    // toggled back and forth before the write - same record, nothing written
+    mock_millis_u32Return = 20000;
+    Presentable_vToggle(psO2);
+    Presentable_vToggle(psO2);
+    PinCfgCsv_vLoop(20000 + PINCFG_STATE_JOURNAL_DELAY_MS_D);
+    TEST_ASSERT_EQUAL(1, mock_hwWriteConfigBlock_u32Called);
+
+    // reset: classic switch comes back on before the first loop, impulse switch does not
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL));
+    psO2 = psFindPresentable("o2");
+    psImp = psFindPresentable("imp");
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psO2));
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psImp));
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psFindPresentable("o1")));
+    TEST_ASSERT_FALSE(psGlobals->bStateJournalDirty);
+    PinCfgCsv_vLoop(30000);
+    TEST_ASSERT_EQUAL(12, mock_digitalWrite_u8Pin);
+    TEST_ASSERT_EQUAL(1, mock_digitalWrite_u8Value);
+
+    // new config - old records do not apply
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,12/SI,imp,10/"));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL));
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psFindPresentable("o2")));
+}
+
+void test_vIntegration_TwoInstances(void)
+{
+    static uint8_t au8MemoryB[MEMORY_SZ];
+    PINCFG_CTX_T *psA = NULL;
+    PINCFG_CTX_T *psB = NULL;
+    MyMessage sMsg;
+
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInitCtx(&psA, testMemory, MEMORY_SZ, "S,o1,13/"));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInitCtx(&psB, au8MemoryB, MEMORY_SZ, "S,o1,13,o2,12/I,i1,16/"));
+    TEST_ASSERT_NOT_NULL(psA);
+    TEST_ASSERT_NOT_NULL(psB);
+    TEST_ASSERT_TRUE(psA != psB);
+    TEST_ASSERT_TRUE(PinCfgCsv_psGetCtx() == psB);
+    TEST_ASSERT_EQUAL(2, psA->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(4, psB->u16PresentablesCount);
+
+    // a message for instance A does not touch the switch with the same id in B
+    memset(&sMsg, 0, sizeof(sMsg));
+    sMsg.sensor = 1;
+    sMsg.type = V_STATUS;
+    mock_MyMessage_getByte_returnValue = 1;
+    PinCfgCsv_vReceiveMessageCtx(psA, &sMsg);
+    TEST_ASSERT_TRUE(PinCfgCsv_psGetCtx() == psA);
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psFindPresentable("o1")));
+    PinCfgCsv_vSetCtx(psB);
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psFindPresentable("o1")));
+
+    PinCfgCsv_vLoopCtx(psA, 100);
+    TEST_ASSERT_EQUAL(13, mock_digitalWrite_u8Pin);
+    TEST_ASSERT_EQUAL(1, mock_digitalWrite_u8Value);
+    PinCfgCsv_vLoopCtx(psB, 100);
+    TEST_ASSERT_TRUE(PinCfgCsv_psGetCtx() == psB);
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psA->ppsPresentables[1]));
+
+    // leave instance A active for the tests that follow
+    PinCfgCsv_vSetCtx(psA);
+}
+
+void test_vIntegration_HotReload(void)
+{
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,12/"));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, NULL));
+    mock_millis_u32Return = 100;
+    Presentable_vSetState(psFindPresentable("o1"), 1, false);
+    PinCfgCsv_vLoop(100 + PINCFG_STATE_JOURNAL_DELAY_MS_D);
+    TEST_ASSERT_FALSE(psGlobals->bStateJournalDirty);
+
+    // applied by the next loop, not from within the caller
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,12,o3,11/"));
+    PinCfgCsv_vRequestReload();
+    TEST_ASSERT_EQUAL(3, psGlobals->u16PresentablesCount);
+
+    mock_bPresent_u32Called = 0;
+    PinCfgCsv_vLoop(200);
+    TEST_ASSERT_FALSE(psGlobals->bReloadPending);
+    // carried over states are journaled under the new config
+    TEST_ASSERT_EQUAL(4, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psFindPresentable("o1")));
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psFindPresentable("o2")));
+    TEST_ASSERT_TRUE(psGlobals->bStateJournalDirty);
+
+    // only the new child is presented
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+    TEST_ASSERT_EQUAL(3, mock_bPresent_u8Id);
+    TEST_ASSERT_EQUAL_STRING("o3", mock_bPresent_pcName);
+    for (uint8_t i = 1; i <= 4; i++)
+        PinCfgCsv_vLoop(200 + i * PINCFG_PRESENTATION_INTERVAL_MS_D);
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+
+    // o1 is renamed, it shifts nothing but is a different child for the controller
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,out1,13,o2,12,o3,11/"));
+    mock_bPresent_u32Called = 0;
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eReload());
+    TEST_ASSERT_EQUAL(0, Presentable_u8GetState(psFindPresentable("out1")));
+    PinCfgCsv_vLoop(2000);
+    PinCfgCsv_vLoop(2000 + PINCFG_PRESENTATION_INTERVAL_MS_D);
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u8Id);
+
+    // nothing stored - the running config stays
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PINCFG_ERROR_E, PinCfgCsv_eReload());
+    TEST_ASSERT_NOT_NULL(psFindPresentable("out1"));
+
+#ifndef USE_MALLOC
+    // a config that would not fit next to the reload buffers is refused before the running one is dropped
+    const char *pcBig = "S,o1,13,o2,12,o3,11,o4,10,o5,9,o6,8/I,i1,2,i2,3,i3,4/T,t1,i1,0,1,o1,2,o2,2/"
+                        "T,t2,i2,0,1,o3,2,o4,2/T,t3,i3,0,1,o5,2,o6,2/";
+    size_t szBig = 0;
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eValidate(pcBig, &szBig, NULL, 0));
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13/I,i1,2/T,t1,i1,0,1,o1,2/"));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, szBig, NULL));
+    char *pcMemNext = psGlobals->pvMemNext;
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig(pcBig));
+    TEST_ASSERT_EQUAL(PINCFG_OUTOFMEMORY_ERROR_E, PinCfgCsv_eReload());
+    TEST_ASSERT_EQUAL(3, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(1, psGlobals->u16SwitchesCount);
+    TEST_ASSERT_TRUE(psGlobals->pvMemNext == pcMemNext);
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+#endif
+}
+
+void test_vIntegration_Profiler(void)
+{
+#if PINCFG_PROFILER_D
+    char acOut[256];
+
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(
+        PINCFG_OK_E,
+        PinCfgCsv_eInit(
+            testMemory,
+            MEMORY_SZ,
+            "MS,0,cpu/SR,temp,cpu,6,6,0,0,1000,60,1.0/S,o1,13/I,i1,16/TC,c1,0,100,1,i1,1,0,o1,1/"));
+    TEST_ASSERT_EQUAL(3, psGlobals->u16LoopablesCount);
+
+    // the mocked clock stands still, every call takes 0 us
+    mock_micros_u32Return = 500;
+    PinCfgCsv_vLoop(10);
+    PinCfgCsv_vLoop(20);
+    TEST_ASSERT_TRUE(Profiler_szGetTextSize() <= sizeof(acOut));
+    TEST_ASSERT_TRUE(Profiler_szReadAndReset(acOut, Profiler_szGetTextSize()) < Profiler_szGetTextSize());
+    TEST_ASSERT_EQUAL_STRING("U:us/CLI,2,0,0/temp,2,0,0/#2,2,0,0/i1,2,0,0/o1,2,0,0", acOut);
+
+    // cleared on read
+    Profiler_szReadAndReset(acOut, sizeof(acOut));
+    TEST_ASSERT_EQUAL_STRING("U:us/CLI,0,0,0/temp,0,0,0/#2,0,0,0/i1,0,0,0/o1,0,0,0", acOut);
+
+    // the loop drives the outputs the same way
+    Presentable_vSetState(psFindPresentable("o1"), 1, false);
+    PinCfgCsv_vLoop(30);
+    TEST_ASSERT_EQUAL(13, mock_digitalWrite_u8Pin);
+    TEST_ASSERT_EQUAL(1, mock_digitalWrite_u8Value);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_vIntegration_Trace(void)
+{
+#if PINCFG_TRACE_D
+    char acOut[TRACE_TEXT_MAX_SZ];
+
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, "S,o1,13/I,i1,16/T,t1,i1,0,0,o1,0/"));
+    IEVENTPUBLISHER_T *psInput = (IEVENTPUBLISHER_T *)&psGlobals->pasInPins[0];
+    uint16_t u16InputId = psInput->sPresentable.u16Id;
+
+    TEST_ASSERT_EQUAL(0, Trace_szRead(acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING("", acOut);
+
+    // the down event fires the trigger on line 2 (toggle), the up event fires nothing
+    EventPublisher_vSendEvent(psInput, TRIGGER_DOWN_E, 0, 100);
+    EventPublisher_vSendEvent(psInput, TRIGGER_UP_E, 0, 150);
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psFindPresentable("o1")));
+
+    char acExpected[64];
+    snprintf(acExpected, sizeof(acExpected), "100,%u,0,0/100,%u,0,0,2,0/150,%u,1,0/", u16InputId, u16InputId, u16InputId);
+    TEST_ASSERT_EQUAL(strlen(acExpected), Trace_szRead(acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING(acExpected, acOut);
+
+    // kept after the read, the oldest entries are overwritten when the ring is full
+    for (uint32_t i = 0; i < PINCFG_TRACE_SIZE_D; i++)
+        EventPublisher_vSendEvent(psInput, TRIGGER_MULTI_E, 2, 200 + i);
+    Trace_szRead(acOut, sizeof(acOut));
+    snprintf(acExpected, sizeof(acExpected), "200,%u,3,2/", u16InputId);
+    TEST_ASSERT_EQUAL(0, strncmp(acExpected, acOut, strlen(acExpected)));
+
+    // a short buffer takes whole entries only
+    TEST_ASSERT_EQUAL(strlen(acExpected), Trace_szRead(acOut, strlen(acExpected) + 4));
+    TEST_ASSERT_EQUAL_STRING(acExpected, acOut);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_vIntegration_StaticConfig(void)
+{
+    // what build-static-config.py generates from the config below
+    const char *pcCfg = "CR,100/S,o1,13/I,i1,16/SF,o2,12,11/T,t1,i1,0,0,o1,0,o2,1/";
+    static const PINCFG_STATIC_SWITCH_T asSwitches[] = {
+        {.pcName = "o1", .u32TimedPeriodMs = 0UL, .u16Id = 1, .u8Mode = 0, .u8Pin = 13, .u8FbPin = 0},
+        {.pcName = "o2", .u32TimedPeriodMs = 0UL, .u16Id = 3, .u8Mode = 0, .u8Pin = 12, .u8FbPin = 11},
+    };
+    static const PINCFG_STATIC_INPIN_T asInPins[] = {{.pcName = "i1", .u16Id = 2, .u8Pin = 16}};
+    static const PINCFG_STATIC_SWITCHACTION_T asActions[] = {
+        {.u16Switch = 0, .u8Action = 0}, {.u16Switch = 1, .u8Action = 1}};
+    static const PINCFG_STATIC_TRIGGER_T asTriggers[] = {
+        {.i32EventData = 0L, .u16InPin = 0, .u16FirstAction = 0, .u16Line = 4, .u8ActionsCount = 2, .u8EventType = 0}};
+    PINCFG_STATIC_CFG_T sCfg = {
+        .pasSwitches = asSwitches,
+        .pasInPins = asInPins,
+        .pasTriggers = asTriggers,
+        .pasActions = asActions,
+        .u32InPinDebounceMs = PINCFG_STATIC_DEFAULT,
+        .u32InPinMulticlickMaxDelayMs = PINCFG_STATIC_DEFAULT,
+        .u32SwitchImpulseDurationMs = 100UL,
+        .u32SwitchFbDelayMs = PINCFG_STATIC_DEFAULT,
+        .u16SwitchesCount = 2,
+        .u16InPinsCount = 1,
+        .u16TriggersCount = 1,
+        .u16ActionsCount = 2};
+    const char *apcNames[] = {"CLI", "o1", "i1", "o2"};
+
+    init_mock_EEPROM_with_default_password();
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInit(testMemory, MEMORY_SZ, pcCfg));
+#if PINCFG_MEMSTATS_D
+    TEST_ASSERT_GREATER_THAN(0, Memory_szGetTagged(MEMORY_TAG_NAMES_E));
+#endif
+
+    // same ids as the parsed config, names are not copied
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eInitStatic(testMemory, MEMORY_SZ, &sCfg));
+    TEST_ASSERT_EQUAL(4, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(1, psGlobals->u16LoopablesCount);
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL(i, psGlobals->ppsPresentables[i]->u16Id);
+        TEST_ASSERT_EQUAL_STRING(apcNames[i], psGlobals->ppsPresentables[i]->pcName);
+    }
+    TEST_ASSERT_TRUE(psFindPresentable("o2")->pcName == asSwitches[1].pcName);
+    TEST_ASSERT_TRUE(psFindPresentable("i1")->pcName == asInPins[0].pcName);
+    TEST_ASSERT_EQUAL(0, Memory_szGetTagged(MEMORY_TAG_NAMES_E));
+    TEST_ASSERT_EQUAL(100, psGlobals->pasSwitches[0].u32ImpulseDuration);
+    TEST_ASSERT_EQUAL(PINCFG_DEBOUNCE_MS_D, psGlobals->u32InPinDebounceMs);
+
+    // pre-linked trigger: toggle o1, switch o2 on
+    EventPublisher_vSendEvent((IEVENTPUBLISHER_T *)&psGlobals->pasInPins[0], TRIGGER_DOWN_E, 0, 100);
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psFindPresentable("o1")));
+    TEST_ASSERT_EQUAL(1, Presentable_u8GetState(psFindPresentable("o2")));
+
+    // tables are checked, a taken id is rejected
+    static const PINCFG_STATIC_INPIN_T asBadInPins[] = {{.pcName = "i1", .u16Id = 1, .u8Pin = 16}};
+    sCfg.pasInPins = asBadInPins;
+    TEST_ASSERT_EQUAL(PINCFG_INVALID_FORMAT_E, PinCfgCsv_eInitStatic(testMemory, MEMORY_SZ, &sCfg));
+    TEST_ASSERT_EQUAL(PINCFG_NULLPTR_ERROR_E, PinCfgCsv_eInitStatic(testMemory, MEMORY_SZ, NULL));
+}
+
 void register_integration_tests(void)
 {
     RUN_TEST(test_vFlow_timedSwitch);
     RUN_TEST(test_vIntegration_CompleteSystem);
+    RUN_TEST(test_vIntegration_PacedPresentation);
     RUN_TEST(test_vIntegration_MemoryExhaustion);
+    RUN_TEST(test_vIntegration_StateJournal);
+    RUN_TEST(test_vIntegration_TwoInstances);
+    RUN_TEST(test_vIntegration_HotReload);
+    RUN_TEST(test_vIntegration_Profiler);
+    RUN_TEST(test_vIntegration_Trace);
+    RUN_TEST(test_vIntegration_StaticConfig);
 }
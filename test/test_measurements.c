@@ -7,7 +7,6 @@
 void test_vCPUTemp(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -23,8 +22,8 @@ void test_vCPUTemp(void)
     // First pass: calculate memory requirements
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -51,19 +50,11 @@ void test_vCPUTemp(void)
     // First pass calculates memory, second pass creates objects
     // The memory calculation only accounts for objects created in pass 1
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    // Presentables: [0]=CLI, [1]=CLI, [2]=CPUTemp0, [3]=CPUTemp1, [4]=CPUTemp1_enable,
-    // [5]=CPUTemp2, [6]=CPUTemp2_enable, [7]=CPUTemp3
+    // Presentables: [0]=CLI, [1]=CPUTemp0, [2]=CPUTemp1, [3]=CPUTemp1_enable,
+    // [4]=CPUTemp2, [5]=CPUTemp2_enable, [6]=CPUTemp3
 
     // Test basic sensor (CPUTemp0: non-cumulative, non-enableable) - defaults
-    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[2];
+    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[1];
     TEST_ASSERT_EQUAL(V_TEMP, psSensor->sVtab.eVType);
     TEST_ASSERT_EQUAL(S_TEMP, psSensor->sVtab.eSType);
     TEST_ASSERT_EQUAL_STRING("CPUTemp0", psSensor->sPresentable.pcName);
@@ -76,7 +67,7 @@ void test_vCPUTemp(void)
     TEST_ASSERT_EQUAL(0, psSensor->u8Flags & SENSOR_FLAG_ENABLEABLE);
 
     // Test cumulative enableable sensor (CPUTemp1) - defaults for scale/offset/precision
-    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[3];
+    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[2];
     TEST_ASSERT_EQUAL(V_TEMP, psSensor->sVtab.eVType);
     TEST_ASSERT_EQUAL(S_TEMP, psSensor->sVtab.eSType);
     TEST_ASSERT_EQUAL_STRING("CPUTemp1", psSensor->sPresentable.pcName);
@@ -88,7 +79,7 @@ void test_vCPUTemp(void)
     TEST_ASSERT_NOT_NULL(psSensor->psEnableable);
 
     // Test sensor with custom parameters (CPUTemp2) - scale, offset, precision
-    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[5];
+    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[4];
     TEST_ASSERT_EQUAL(V_TEMP, psSensor->sVtab.eVType);
     TEST_ASSERT_EQUAL(S_TEMP, psSensor->sVtab.eSType);
     TEST_ASSERT_EQUAL_STRING("CPUTemp2", psSensor->sPresentable.pcName);
@@ -101,7 +92,7 @@ void test_vCPUTemp(void)
     TEST_ASSERT_NOT_EQUAL(0, psSensor->u8Flags & SENSOR_FLAG_ENABLEABLE);
 
     // Test sensor with scale factor (CPUTemp3) - 0.5 scale, 10.5 offset, 3 decimals
-    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[7];
+    psSensor = (SENSOR_T *)psGlobals->ppsPresentables[6];
     TEST_ASSERT_EQUAL(V_TEMP, psSensor->sVtab.eVType);
     TEST_ASSERT_EQUAL(S_TEMP, psSensor->sVtab.eSType);
     TEST_ASSERT_EQUAL_STRING("CPUTemp3", psSensor->sPresentable.pcName);
@@ -826,7 +817,6 @@ void test_vSPIMeasure_CSPinControl(void)
 void test_vSPIMeasure_CSVParsing_Simple(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -839,8 +829,8 @@ void test_vSPIMeasure_CSVParsing_Simple(void)
     // First pass: calculate memory requirements
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -863,13 +853,6 @@ void test_vSPIMeasure_CSVParsing_Simple(void)
     }
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
 }
 
 /**
@@ -878,7 +861,6 @@ void test_vSPIMeasure_CSVParsing_Simple(void)
 void test_vSPIMeasure_CSVParsing_Command(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -891,8 +873,8 @@ void test_vSPIMeasure_CSVParsing_Command(void)
     // First pass: calculate memory requirements
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -915,13 +897,6 @@ void test_vSPIMeasure_CSVParsing_Command(void)
     }
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
 }
 
 /**
@@ -930,7 +905,6 @@ void test_vSPIMeasure_CSVParsing_Command(void)
 void test_vSPIMeasure_CSVParsing_Sensor(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -943,8 +917,8 @@ void test_vSPIMeasure_CSVParsing_Sensor(void)
     // First pass: calculate memory
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -967,16 +941,8 @@ void test_vSPIMeasure_CSVParsing_Sensor(void)
     }
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     // Verify sensor was created
-    TEST_ASSERT_GREATER_THAN(0, psGlobals->u8PresentablesCount);
+    TEST_ASSERT_GREATER_THAN(0, psGlobals->u16PresentablesCount);
 }
 
 #endif // PINCFG_FEATURE_SPI_MEASUREMENT
@@ -1144,7 +1110,6 @@ void test_vAnalogMeasure_MultiplePins(void)
 void test_vAnalogMeasure_CSVParsing(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -1157,8 +1122,8 @@ void test_vAnalogMeasure_CSVParsing(void)
     // First pass: calculate memory requirements
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -1181,14 +1146,6 @@ void test_vAnalogMeasure_CSVParsing(void)
     }
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     // Verify analog measurement sources were created
     // Note: The measurement sources are stored in global registry, not as presentables
     // We'll verify them by using them with sensors
@@ -1200,7 +1157,6 @@ void test_vAnalogMeasure_CSVParsing(void)
 void test_vAnalogMeasure_SensorIntegration(void)
 {
     PINCFG_RESULT_T eResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -1216,8 +1172,8 @@ void test_vAnalogMeasure_SensorIntegration(void)
     // First pass: calculate memory
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -1240,17 +1196,9 @@ void test_vAnalogMeasure_SensorIntegration(void)
     }
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     // Verify sensor was created
-    // Presentables: [0]=CLI, [1]=CLI, [2]=BatteryVolt sensor
-    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[2];
+    // Presentables: [0]=CLI, [1]=BatteryVolt sensor
+    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[1];
     TEST_ASSERT_EQUAL_STRING("BatteryVolt", psSensor->sPresentable.pcName);
     TEST_ASSERT_EQUAL(38, psSensor->sVtab.eVType); // V_VOLTAGE
     TEST_ASSERT_EQUAL(0, psSensor->sVtab.eSType);  // S_POWER
@@ -1481,8 +1429,8 @@ void test_vLoopTimeMeasure_CSVParsing(void)
     // Use two-pass parsing like other tests
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -1498,13 +1446,9 @@ void test_vLoopTimeMeasure_CSVParsing(void)
     eResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    // Convert linked lists to arrays
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
     // Note: Measurement sources are now stored internally and accessed via sensors
-    // Verify sensor was created (presentables: [0]=CLI, [1]=CLI, [2]=LoopTime)
-    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[2];
+    // Verify sensor was created (presentables: [0]=CLI, [1]=LoopTime)
+    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[1];
     TEST_ASSERT_EQUAL_STRING("LoopTime", psSensor->sPresentable.pcName);
     TEST_ASSERT_EQUAL(99, psSensor->sVtab.eVType);
     TEST_ASSERT_EQUAL(99, psSensor->sVtab.eSType);
@@ -1535,8 +1479,8 @@ void test_vLoopTimeMeasure_SensorIntegration(void)
     // Use two-pass parsing like other tests
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -1551,12 +1495,8 @@ void test_vLoopTimeMeasure_SensorIntegration(void)
     eResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    // Convert linked lists to arrays
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
-    // Get the sensor (should be at index 2: [0]=CLI, [1]=CLI, [2]=LoopTime)
-    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[2];
+    // Get the sensor (should be at index 1: [0]=CLI, [1]=LoopTime)
+    SENSOR_T *psSensor = (SENSOR_T *)psGlobals->ppsPresentables[1];
     TEST_ASSERT_NOT_NULL(psSensor);
 
     // Verify cumulative mode is set (critical for this test to work)
@@ -1640,8 +1580,8 @@ void test_vLoopTimeMeasure_MultipleSensors(void)
     // Use two-pass parsing like other tests
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -1656,14 +1596,10 @@ void test_vLoopTimeMeasure_MultipleSensors(void)
     eResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eResult);
 
-    // Convert linked lists to arrays
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-
     // Note: Measurements are now internal, accessed via sensors
-    // Verify two sensors created (presentables: [0]=CLI, [1]=CLI, [2]=Loop1, [3]=Loop2)
-    SENSOR_T *psSensor1 = (SENSOR_T *)psGlobals->ppsPresentables[2];
-    SENSOR_T *psSensor2 = (SENSOR_T *)psGlobals->ppsPresentables[3];
+    // Verify two sensors created (presentables: [0]=CLI, [1]=Loop1, [2]=Loop2)
+    SENSOR_T *psSensor1 = (SENSOR_T *)psGlobals->ppsPresentables[1];
+    SENSOR_T *psSensor2 = (SENSOR_T *)psGlobals->ppsPresentables[2];
     TEST_ASSERT_EQUAL_STRING("Loop1", psSensor1->sPresentable.pcName);
     TEST_ASSERT_EQUAL_STRING("Loop2", psSensor2->sPresentable.pcName);
     TEST_ASSERT_EQUAL(5000, psSensor1->u32ReportIntervalMs);
@@ -2,28 +2,53 @@
 
 // Parsing Tests - PinCfgCsv, GlobalConfig
 
+// Memory taken by szCount names of szLen characters, packed the way Memory_pcNameAlloc packs them
+static size_t szNamesRequired(size_t szCount, size_t szLen, size_t *pszChunkLeft)
+{
+    size_t szResult = 0;
+    for (size_t i = 0; i < szCount; i++)
+        szResult += Memory_szGetNameAllocatedSize(szLen, pszChunkLeft);
+    return szResult;
+}
+
+// Memory taken by the profiler entries of the given components, nothing when the profiler is compiled out
+static size_t szProfilerRequired(size_t szLoopables, size_t szInPins, size_t szSwitches)
+{
+#if PINCFG_PROFILER_D
+    return Memory_szGetAllocatedSize(sizeof(PROFILER_ENTRY_T) * (szLoopables + szInPins + szSwitches));
+#else
+    (void)szLoopables;
+    (void)szInPins;
+    (void)szSwitches;
+    return 0;
+#endif
+}
+
 void test_vPinCfgCsv(void)
 {
     PINCFG_RESULT_T eParseResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
     size_t szRequiredMem;
+    size_t szChunkLeft;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
         .bValidate = false};
 
 #ifndef USE_MALLOC
-    Memory_vpAlloc((size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext - sizeof(char *)));
+    // room for the item arrays but not for the CLI
+    Memory_vpAlloc(
+        (size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext - 2 * sizeof(char *)) - szProfilerRequired(1, 0, 0));
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_OUTOFMEMORY_ERROR_E, eParseResult);
     // Accept either full error message or error code
@@ -37,9 +62,9 @@ void test_vPinCfgCsv(void)
 
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_NULLPTR_ERROR_E, eParseResult);
 #ifdef PINCFG_USE_ERROR_MESSAGES
@@ -52,9 +77,9 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_ERROR_E, eParseResult);
 #ifdef PINCFG_USE_ERROR_MESSAGES
@@ -67,9 +92,9 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "S";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     // Note: Memory size check skipped - depends on error message string length
     // TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_WARNINGS_E, eParseResult);
@@ -83,9 +108,9 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "S,o1";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     // Note: Memory size check skipped - depends on error message string length
     // TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_WARNINGS_E, eParseResult);
@@ -99,9 +124,9 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "S,o1,afsd";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     // Note: Memory size check skipped - depends on error message string length
     // TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_WARNINGS_E, eParseResult);
@@ -115,9 +140,10 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "S,o1,afsd,o2";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
+    szRequiredMem += szProfilerRequired(1, 0, 0);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_WARNINGS_E, eParseResult);
 #ifdef PINCFG_USE_ERROR_MESSAGES
@@ -128,23 +154,24 @@ void test_vPinCfgCsv(void)
     Memory_eReset();
 
 #ifndef USE_MALLOC
-    Memory_vpAlloc((size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext - sizeof(char *) - sizeof(CLI_T)));
+    // room for the item arrays but not for the switch array allocated next to them
+    Memory_vpAlloc((size_t)(psGlobals->pvMemTempEnd - psGlobals->pvMemNext - 3 * sizeof(char *)));
     sParams.pcConfig = "S,o1,2";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(SWITCH_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3);
-    szRequiredMem +=
-        Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 2; /* loopables, presentables */
+    szRequiredMem += szNamesRequired(1, 2, &szChunkLeft);
+    szRequiredMem += sizeof(void *); /* presentables, switches are not loopables */
+    szRequiredMem += szProfilerRequired(1, 0, 1);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_OUTOFMEMORY_ERROR_E, eParseResult);
 #ifdef PINCFG_USE_ERROR_MESSAGES
-    TEST_ASSERT_EQUAL_STRING("E:L:0:Switch:OOM\n", acOutStr); // OOM message format
+    TEST_ASSERT_EQUAL_STRING("E:OOM\n", acOutStr); // arrays are allocated before any line is parsed
 #else
-    TEST_ASSERT_EQUAL_STRING("L0:E10;", acOutStr); // ERR_MEMORY = 10 (no newline on error)
+    TEST_ASSERT_EQUAL_STRING("E10\n", acOutStr); // ERR_MEMORY = 10
 #endif
     Memory_eReset();
 
@@ -159,33 +186,36 @@ void test_vPinCfgCsv(void)
     sParams.pcConfig = "# (bluePill)/";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
+    szRequiredMem += szProfilerRequired(1, 0, 0);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     Memory_eReset();
 
     sParams.pcConfig = "S,o1,13,o2,12/";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(SWITCH_T)) * 2;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3) * 2;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 4;
+    szRequiredMem += szNamesRequired(2, 2, &szChunkLeft);
+    szRequiredMem += sizeof(void *) * 2;
+    szRequiredMem += szProfilerRequired(1, 0, 2);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     Memory_eReset();
 
     sParams.pcConfig = "I,i1,16/";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(INPIN_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3);
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 2;
+    szRequiredMem += szNamesRequired(1, 2, &szChunkLeft);
+    szRequiredMem += sizeof(void *);
+    szRequiredMem += szProfilerRequired(1, 1, 0);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     Memory_eReset();
 
@@ -194,17 +224,18 @@ void test_vPinCfgCsv(void)
                        "T,vtl12,i1,0,1,o1,2,o2,2/";
     eParseResult = PinCfgCsv_eParse(&sParams);
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(SWITCH_T)) * 2;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3) * 2;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 4;
+    szRequiredMem += szNamesRequired(2, 2, &szChunkLeft);
+    szRequiredMem += sizeof(void *) * 2;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(INPIN_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3);
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 2;
+    szRequiredMem += szNamesRequired(1, 2, &szChunkLeft);
+    szRequiredMem += sizeof(void *);
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(TRIGGER_T));
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(TRIGGER_SWITCHACTION_T)) * 2;
+    szRequiredMem += szProfilerRequired(1, 1, 2);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     Memory_eReset();
 
@@ -217,19 +248,20 @@ void test_vPinCfgCsv(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
 
     szRequiredMem = Memory_szGetAllocatedSize(sizeof(GLOBALS_T));
+    szChunkLeft = 0;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(CLI_T));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *));
+    szRequiredMem += sizeof(void *) * 2; /* CLI slots in loopables, presentables */
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(SWITCH_T)) * 10;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3) * 7;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 4) * 3;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 20;
+    szRequiredMem += szNamesRequired(7, 2, &szChunkLeft);
+    szRequiredMem += szNamesRequired(3, 3, &szChunkLeft);
+    szRequiredMem += sizeof(void *) * 10;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(INPIN_T)) * 12;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 3) * 9;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(char) * 4) * 3;
-    szRequiredMem += Memory_szGetAllocatedSize(sizeof(LINKEDLIST_ITEM_T) + sizeof(void *)) * 24;
+    szRequiredMem += szNamesRequired(9, 2, &szChunkLeft);
+    szRequiredMem += szNamesRequired(3, 3, &szChunkLeft);
+    szRequiredMem += sizeof(void *) * 12;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(TRIGGER_T)) * 2;
     szRequiredMem += Memory_szGetAllocatedSize(sizeof(TRIGGER_SWITCHACTION_T)) * 3;
+    szRequiredMem += szProfilerRequired(1, 12, 10);
     TEST_ASSERT_EQUAL(szRequiredMem, szMemoryRequired);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 #ifdef PINCFG_USE_ERROR_MESSAGES
@@ -359,8 +391,82 @@ void test_vGlobalConfig(void)
 #endif
 }
 
+void test_vPinCfgCsv_ItemArrays(void)
+{
+    char acOutStr[OUT_STR_MAX_LEN_D];
+    PINCFG_PARSE_PARAMS_T sParams = {
+        .pcConfig = "S,o1,13,o2,12/"
+                    "I,i1,16/"
+                    "T,t1,i1,0,1,o1,2/"
+                    "TC,c1,0,100,1,i1,1,0,o2,1/",
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
+        .pszMemoryRequired = NULL,
+        .pcOutString = acOutStr,
+        .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
+        .bValidate = false};
+
+    Memory_eReset();
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eParse(&sParams));
+
+    // the counting pass sizes both arrays exactly, nothing is left in the temp region
+    TEST_ASSERT_EQUAL(4, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(psGlobals->u16PresentablesCount, psGlobals->u16PresentablesMax);
+    TEST_ASSERT_EQUAL(2, psGlobals->u16LoopablesCount);
+    TEST_ASSERT_EQUAL(psGlobals->u16LoopablesCount, psGlobals->u16LoopablesMax);
+#ifndef USE_MALLOC
+    TEST_ASSERT_EQUAL(psGlobals->pvMemEnd, psGlobals->pvMemTempEnd);
+    // arrays come first, ahead of the components
+    TEST_ASSERT_EQUAL(
+        (char *)psGlobals + Memory_szGetAllocatedSize(sizeof(GLOBALS_T)), (char *)psGlobals->ppsLoopables);
+#endif // USE_MALLOC
+    TEST_ASSERT_EQUAL_STRING("o1", psGlobals->ppsPresentables[1]->pcName);
+    TEST_ASSERT_EQUAL_STRING("i1", psGlobals->ppsPresentables[3]->pcName);
+
+    // switches and inputs sit next to each other in their typed arrays
+    TEST_ASSERT_EQUAL(2, psGlobals->u16SwitchesCount);
+    TEST_ASSERT_EQUAL(psGlobals->u16SwitchesCount, psGlobals->u16SwitchesMax);
+    TEST_ASSERT_EQUAL(1, psGlobals->u16InPinsCount);
+    TEST_ASSERT_EQUAL(psGlobals->u16InPinsCount, psGlobals->u16InPinsMax);
+    TEST_ASSERT_EQUAL(&psGlobals->pasSwitches[0], psGlobals->ppsPresentables[1]);
+    TEST_ASSERT_EQUAL(&psGlobals->pasSwitches[1], psGlobals->ppsPresentables[2]);
+    TEST_ASSERT_EQUAL(&psGlobals->pasInPins[0], psGlobals->ppsPresentables[3]);
+
+    // adding past the counted size is refused
+    TEST_ASSERT_EQUAL(PINCFG_OUTOFMEMORY_ERROR_E, PinCfgCsv_eAddToPresentables(psGlobals->ppsPresentables[1]));
+    TEST_ASSERT_EQUAL(PINCFG_OUTOFMEMORY_ERROR_E, PinCfgCsv_eAddToLoopables(psGlobals->ppsLoopables[1]));
+
+    Memory_eReset();
+}
+
+void test_vPinCfgCsv_Patch(void)
+{
+    char acOut[128];
+    const char *pcCfg = "CD,330/S,o1,13,o2,12/I,i1,16/MS,0,cpu/T,t1,i1,0,1,o1,0/";
+
+    // replaced in place, deleted, appended
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_ePatch(pcCfg, "T,t1,i1,0,1,o2,0/-o1/S,o3,11", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING("CD,330/I,i1,16/MS,0,cpu/T,t1,i1,0,1,o2,0/S,o3,11/", acOut);
+
+    // global items by their type, measurement sources by the name after the type
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_ePatch(pcCfg, "CD,500/MS,0,cpu,1/-t1", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING("CD,500/S,o1,13,o2,12/I,i1,16/MS,0,cpu,1/", acOut);
+
+    // unterminated last line, in place
+    strcpy(acOut, "S,o1,13");
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_ePatch(acOut, "I,i1,16/", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL_STRING("S,o1,13/I,i1,16/", acOut);
+
+    TEST_ASSERT_EQUAL(PINCFG_ERROR_E, PinCfgCsv_ePatch(pcCfg, "-o9", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL(PINCFG_INVALID_FORMAT_E, PinCfgCsv_ePatch(pcCfg, "-", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL(PINCFG_INVALID_FORMAT_E, PinCfgCsv_ePatch(pcCfg, "S", acOut, sizeof(acOut)));
+    TEST_ASSERT_EQUAL(PINCFG_MAXLEN_ERROR_E, PinCfgCsv_ePatch(pcCfg, "S,o3,11", acOut, strlen(pcCfg) + 4));
+}
+
 void register_parsing_tests(void)
 {
     RUN_TEST(test_vPinCfgCsv);
+    RUN_TEST(test_vPinCfgCsv_ItemArrays);
+    RUN_TEST(test_vPinCfgCsv_Patch);
     RUN_TEST(test_vGlobalConfig);
 }
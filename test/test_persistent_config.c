@@ -281,8 +281,14 @@ void test_vPersistentCfg_ConfigCorruption_BeyondBackup(void)
     // Backup start = 451 + 300 + 22 = 773
     // Backup max = 1024 - 773 = 251 bytes (less than 332 needed)
     // Backup covers: 32 (pwd) + 219 (partial cfg) = 251 bytes
+    // Pseudo random printable text, so config compression can not make it smaller
     char test_config[350];
-    memset(test_config, 'X', 300);
+    uint32_t u32Seed = 12345;
+    for (int i = 0; i < 300; i++)
+    {
+        u32Seed = u32Seed * 1103515245U + 12345U;
+        test_config[i] = (char)('!' + ((u32Seed >> 16) % 90));
+    }
     test_config[300] = '\0';
 
     // Convert hex password to binary
@@ -563,6 +569,242 @@ void test_vPersistentCfg_ConfigSizeQuery(void)
     }
 }
 
+/**
+ * Test: Repetitive config is stored packed and unpacked transparently on load
+ */
+void test_vPersistentCfg_CompressedConfig(void)
+{
+    init_mock_EEPROM();
+
+    uint8_t au8PasswordBinary[32];
+    memset(au8PasswordBinary, 0x5A, 32);
+    char test_config[PINCFG_CONFIG_MAX_SZ_D];
+    test_config[0] = '\0';
+    strcat(test_config, "CD,50/S,o01,13,o02,12,o03,11,o04,10/I,i01,16,i02,15,i03,14,i04,9/");
+    for (int i = 1; i <= 4; i++)
+    {
+        char acLine[32];
+        sprintf(acLine, "T,t%02d,i%02d,1,1,o%02d,0/", i, i, i);
+        strcat(test_config, acLine);
+    }
+    uint16_t u16TextLen = strlen(test_config);
+
+    PERCFG_RESULT_T result = PersistentCfg_eWritePassword(au8PasswordBinary);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    result = PersistentCfg_eSaveConfig(test_config);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+
+    // stored packed, well below the text size even for such a small config
+    uint16_t config_start = EEPROM_LOCAL_CONFIG_ADDRESS + 6 + PINCFG_AUTH_PASSWORD_LEN_D;
+    uint16_t u16StoredLen = strlen((const char *)&mock_EEPROM[config_start]);
+    TEST_ASSERT_EQUAL(0x7F, mock_EEPROM[config_start]);
+    TEST_ASSERT_TRUE(u16StoredLen * 3 < u16TextLen * 2);
+
+    uint16_t u16Size = 0;
+    result = PersistentCfg_eGetConfigSize(&u16Size);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(u16TextLen, u16Size);
+    result = PersistentCfg_eGetStoredSize(&u16Size);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(u16StoredLen + 1, u16Size);
+
+    // exactly sized buffer like the callers use
+    char config_buffer[PINCFG_CONFIG_MAX_SZ_D];
+    memset(config_buffer, 0xEE, sizeof(config_buffer));
+    result = PersistentCfg_eLoadConfig(config_buffer);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL_STRING(test_config, config_buffer);
+    TEST_ASSERT_EQUAL(0xEE, (uint8_t)config_buffer[u16TextLen + 1]);
+
+    // password change keeps the packed config intact
+    memset(au8PasswordBinary, 0xA5, 32);
+    result = PersistentCfg_eWritePassword(au8PasswordBinary);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    memset(config_buffer, 0, sizeof(config_buffer));
+    result = PersistentCfg_eLoadConfig(config_buffer);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL_STRING(test_config, config_buffer);
+
+    // corruption of the packed data is repaired from the backup
+    corrupt_EEPROM_byte(config_start + 5, 3);
+    memset(config_buffer, 0, sizeof(config_buffer));
+    result = PersistentCfg_eLoadConfig(config_buffer);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL_STRING(test_config, config_buffer);
+}
+
+/**
+ * Test: Text that does not pack (short or non ASCII) is stored as is
+ */
+void test_vPersistentCfg_UncompressedConfig(void)
+{
+    init_mock_EEPROM();
+
+    uint8_t au8PasswordBinary[32];
+    memset(au8PasswordBinary, 0x5A, 32);
+    const char *configs[] = {"CD,50/", "S,sv\xC3\xA9tlo1,13/S,sv\xC3\xA9tlo2,12/S,sv\xC3\xA9tlo3,11/"};
+    uint16_t config_start = EEPROM_LOCAL_CONFIG_ADDRESS + 6 + PINCFG_AUTH_PASSWORD_LEN_D;
+
+    for (int i = 0; i < 2; i++)
+    {
+        PERCFG_RESULT_T result = PersistentCfg_eWritePassword(au8PasswordBinary);
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+        result = PersistentCfg_eSaveConfig(configs[i]);
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+        TEST_ASSERT_EQUAL_STRING(configs[i], (const char *)&mock_EEPROM[config_start]);
+        uint16_t u16Stored = 0;
+        result = PersistentCfg_eGetStoredSize(&u16Stored);
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+        TEST_ASSERT_EQUAL(strlen(configs[i]) + 1, u16Stored);
+
+        char config_buffer[PINCFG_CONFIG_MAX_SZ_D];
+        memset(config_buffer, 0, sizeof(config_buffer));
+        result = PersistentCfg_eLoadConfig(config_buffer);
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+        TEST_ASSERT_EQUAL_STRING(configs[i], config_buffer);
+    }
+}
+
+/**
+ * Test: Saving touches only the blocks that changed
+ */
+void test_vPersistentCfg_DifferentialWrite(void)
+{
+    init_mock_EEPROM();
+
+    uint8_t au8PasswordBinary[32];
+    memset(au8PasswordBinary, 0x5A, 32);
+    // non ASCII marker keeps the config stored as is, so a one char change stays a one block change
+    char test_config[200];
+    memset(test_config, 'Q', sizeof(test_config) - 1);
+    test_config[0] = (char)0xC3;
+    test_config[sizeof(test_config) - 1] = '\0';
+
+    PERCFG_RESULT_T result = PersistentCfg_eWritePassword(au8PasswordBinary);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    result = PersistentCfg_eSaveConfig(test_config);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+
+    // same data again - nothing is written at all
+    mock_hwWriteConfigBlock_u32Called = 0;
+    result = PersistentCfg_eSaveConfig(test_config);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(0, mock_hwWriteConfigBlock_u32Called);
+    result = PersistentCfg_eWritePassword(au8PasswordBinary);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(0, mock_hwWriteConfigBlock_u32Called);
+
+    // one char changed - data block, its backup copy, block CRCs and CRC16 only
+    test_config[100] = 'R';
+    result = PersistentCfg_eSaveConfig(test_config);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(4, mock_hwWriteConfigBlock_u32Called);
+
+    char config_buffer[PINCFG_CONFIG_MAX_SZ_D];
+    memset(config_buffer, 0, sizeof(config_buffer));
+    result = PersistentCfg_eLoadConfig(config_buffer);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL_STRING(test_config, config_buffer);
+
+    // a block corrupted in EEPROM is rewritten even if the data did not change
+    corrupt_EEPROM_byte(EEPROM_LOCAL_CONFIG_ADDRESS + 6 + PINCFG_AUTH_PASSWORD_LEN_D + 50, 2);
+    mock_hwWriteConfigBlock_u32Called = 0;
+    result = PersistentCfg_eSaveConfig(test_config);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL(1, mock_hwWriteConfigBlock_u32Called);
+    memset(config_buffer, 0, sizeof(config_buffer));
+    result = PersistentCfg_eLoadConfig(config_buffer);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, result);
+    TEST_ASSERT_EQUAL_STRING(test_config, config_buffer);
+}
+
+/**
+ * Test: CRCs match the reference values whatever PINCFG_CRC_MODE_D computes them with
+ */
+void test_vPersistentCfg_CrcKnownAnswer(void)
+{
+    const uint8_t au8Check[] = "123456789";
+    uint8_t au8Data[100];
+
+    // CRC-16/CCITT-FALSE and CRC-8 (poly 0x07, init 0xFF) check values
+    TEST_ASSERT_EQUAL(0x29B1, crc16(au8Check, 9));
+    TEST_ASSERT_EQUAL(0xFB, crc8(au8Check, 9));
+    TEST_ASSERT_EQUAL(0xFFFF, crc16(au8Check, 0));
+    TEST_ASSERT_EQUAL(0xFF, crc8(au8Check, 0));
+
+    // all byte values against the bit by bit definition
+    for (uint16_t i = 0; i < sizeof(au8Data); i++)
+        au8Data[i] = (uint8_t)(i * 37U + 11U);
+    for (uint16_t u16Len = 1; u16Len <= sizeof(au8Data); u16Len += 33)
+    {
+        uint16_t u16Crc = 0xFFFF;
+        uint8_t u8Crc = 0xFF;
+        for (uint16_t i = 0; i < u16Len; i++)
+        {
+            u16Crc ^= (uint16_t)au8Data[i] << 8;
+            u8Crc ^= au8Data[i];
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                u16Crc = (u16Crc & 0x8000) ? (uint16_t)((u16Crc << 1) ^ 0x1021) : (uint16_t)(u16Crc << 1);
+                u8Crc = (u8Crc & 0x80) ? (uint8_t)((u8Crc << 1) ^ 0x07) : (uint8_t)(u8Crc << 1);
+            }
+        }
+        TEST_ASSERT_EQUAL(u16Crc, crc16(au8Data, u16Len));
+        TEST_ASSERT_EQUAL(u8Crc, crc8(au8Data, u16Len));
+    }
+}
+
+/**
+ * Test: State journal keeps the newest record, spreads writes over the slots and follows the config
+ */
+void test_vPersistentCfg_StateJournal(void)
+{
+    init_mock_EEPROM();
+
+    uint8_t au8PasswordBinary[32];
+    memset(au8PasswordBinary, 0x5A, 32);
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eWritePassword(au8PasswordBinary));
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,12/"));
+
+    uint8_t au8State[2] = {0};
+    TEST_ASSERT_EQUAL(PERCFG_READ_FAILED_E, PersistentCfg_eReadState(au8State, 2));
+    TEST_ASSERT_EQUAL(PERCFG_OUT_OF_RANGE_E, PersistentCfg_eReadState(au8State, 0));
+    TEST_ASSERT_EQUAL(PERCFG_OUT_OF_RANGE_E, PersistentCfg_eWriteState(au8State, PERCFG_STATE_MAX_SZ + 1));
+
+    // many more writes than slots, each lands in a different place than the previous one
+    uint8_t *pu8LastAddr = NULL;
+    for (uint16_t i = 0; i < 300; i++)
+    {
+        au8State[0] = (uint8_t)i;
+        au8State[1] = (uint8_t)(i >> 8);
+        mock_hwWriteConfigBlock_u32Called = 0;
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eWriteState(au8State, 2));
+        TEST_ASSERT_EQUAL(1, mock_hwWriteConfigBlock_u32Called);
+        TEST_ASSERT_TRUE(pu8LastAddr != (uint8_t *)mock_hwWriteConfigBlock_addr);
+        pu8LastAddr = (uint8_t *)mock_hwWriteConfigBlock_addr;
+
+        uint8_t au8Read[2] = {0};
+        TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eReadState(au8Read, 2));
+        TEST_ASSERT_EQUAL_MEMORY(au8State, au8Read, 2);
+    }
+
+    // same state again is not written
+    mock_hwWriteConfigBlock_u32Called = 0;
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eWriteState(au8State, 2));
+    TEST_ASSERT_EQUAL(0, mock_hwWriteConfigBlock_u32Called);
+
+    // the config still loads, the journal stays out of its way
+    char config_buffer[PINCFG_CONFIG_MAX_SZ_D];
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eLoadConfig(config_buffer));
+    TEST_ASSERT_EQUAL_STRING("S,o1,13,o2,12/", config_buffer);
+
+    // records of a different size or config are ignored
+    uint8_t au8Other[3];
+    TEST_ASSERT_EQUAL(PERCFG_READ_FAILED_E, PersistentCfg_eReadState(au8Other, 3));
+    TEST_ASSERT_EQUAL(PERCFG_OK_E, PersistentCfg_eSaveConfig("S,o1,13,o2,11/"));
+    TEST_ASSERT_EQUAL(PERCFG_READ_FAILED_E, PersistentCfg_eReadState(au8State, 2));
+}
+
 // ============================================================================
 // Test Registration Function
 // ============================================================================
@@ -586,4 +828,9 @@ void register_persistent_config_tests(void)
     RUN_TEST(test_vPersistentCfg_CRC16_AllDifferent);
     RUN_TEST(test_vPersistentCfg_BlockCRC_DoubleRedundancy);
     RUN_TEST(test_vPersistentCfg_ConfigSizeQuery);
+    RUN_TEST(test_vPersistentCfg_CompressedConfig);
+    RUN_TEST(test_vPersistentCfg_UncompressedConfig);
+    RUN_TEST(test_vPersistentCfg_DifferentialWrite);
+    RUN_TEST(test_vPersistentCfg_CrcKnownAnswer);
+    RUN_TEST(test_vPersistentCfg_StateJournal);
 }
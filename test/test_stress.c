@@ -51,7 +51,6 @@ void test_vMillisWraparound_ElapsedTime(void)
 void test_vMillisWraparound_InPinDebounce(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -60,8 +59,8 @@ void test_vMillisWraparound_InPinDebounce(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -76,14 +75,6 @@ void test_vMillisWraparound_InPinDebounce(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     INPIN_T *psInPin = (INPIN_T *)psGlobals->ppsPresentables[1];
 
     // Start just before wraparound
@@ -151,7 +142,6 @@ void test_vMillisWraparound_SwitchImpulse(void)
 void test_vMillisWraparound_SensorReporting(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -160,8 +150,8 @@ void test_vMillisWraparound_SensorReporting(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -176,14 +166,6 @@ void test_vMillisWraparound_SensorReporting(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     // Start just before wraparound
     uint32_t u32Time = UINT32_MAX - 2000; // 2 seconds before wrap
     mock_send_u32Called = 0;
@@ -211,7 +193,6 @@ void test_vMillisWraparound_SensorReporting(void)
 void test_vConcurrentTriggers_MultipleOnSameInput(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -223,8 +204,8 @@ void test_vConcurrentTriggers_MultipleOnSameInput(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -239,14 +220,6 @@ void test_vConcurrentTriggers_MultipleOnSameInput(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     INPIN_T *psInPin = (INPIN_T *)psGlobals->ppsPresentables[1];
 
     // Verify triggers are subscribed to the input pin
@@ -271,7 +244,6 @@ void test_vConcurrentTriggers_MultipleOnSameInput(void)
 void test_vConcurrentTriggers_MultipleActions(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -282,8 +254,8 @@ void test_vConcurrentTriggers_MultipleActions(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -298,14 +270,6 @@ void test_vConcurrentTriggers_MultipleActions(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     INPIN_T *psInPin = (INPIN_T *)psGlobals->ppsPresentables[1];
 
     // Verify trigger is subscribed with correct structure
@@ -328,7 +292,6 @@ void test_vConcurrentTriggers_MultipleActions(void)
 void test_vConcurrentTriggers_RapidEvents(void)
 {
     PINCFG_RESULT_T eParseResult;
-    LINKEDLIST_RESULT_T eLinkedListResult;
     char acOutStr[OUT_STR_MAX_LEN_D];
     size_t szMemoryRequired;
 
@@ -340,8 +303,8 @@ void test_vConcurrentTriggers_RapidEvents(void)
 
     PINCFG_PARSE_PARAMS_T sParams = {
         .pcConfig = pcCfg,
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -356,14 +319,6 @@ void test_vConcurrentTriggers_RapidEvents(void)
     eParseResult = PinCfgCsv_eParse(&sParams);
     TEST_ASSERT_EQUAL(PINCFG_OK_E, eParseResult);
 
-    eLinkedListResult =
-        LinkedList_eLinkedListToArray((LINKEDLIST_ITEM_T **)(&psGlobals->ppsLoopables), &psGlobals->u8LoopablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
-    eLinkedListResult = LinkedList_eLinkedListToArray(
-        (LINKEDLIST_ITEM_T **)(&psGlobals->ppsPresentables), &psGlobals->u8PresentablesCount);
-    TEST_ASSERT_EQUAL(LINKEDLIST_OK_E, eLinkedListResult);
-
     SWITCH_T *psSwitch = (SWITCH_T *)psGlobals->ppsPresentables[2];
     uint32_t u32Time = 0;
 
@@ -429,44 +384,75 @@ void test_vMaxArraySize_TriggerMaxSwitches(void)
 }
 
 /**
- * Test: Presentables count near 255 limit
+ * Test: More than 255 config lines, presentables up to the last MySensors child id
  */
 void test_vMaxArraySize_PresentablesCount(void)
 {
-    // This test validates that u8PresentablesCount doesn't overflow
-    // when many presentables are created
-
-    // Note: We can't actually create 256 presentables due to memory constraints
-    // but we can verify the counter behavior with a simpler test
+    static uint8_t au8Memory[65536];
+    static char acCfg[300 * 10 + 1];
+    char acOutStr[OUT_STR_MAX_LEN_D];
+    size_t szLen = 0;
+    size_t szMemoryRequired = 0;
 
-    uint8_t u8Count = 254;
+    // one switch per line after the CLI (id 0) up to the last child id, then comments up to 300 lines
+    for (int i = 0; i < PINCFG_CHILD_IDS_MAX_D - 1; i++)
+        szLen += (size_t)sprintf(&acCfg[szLen], "S,o%d,1/", i);
+    for (int i = PINCFG_CHILD_IDS_MAX_D - 1; i < 300; i++)
+        szLen += (size_t)sprintf(&acCfg[szLen], "#c/");
 
-    // Simulate incrementing counter
-    u8Count++;
-    TEST_ASSERT_EQUAL(255, u8Count);
+    PINCFG_PARSE_PARAMS_T sParams = {
+        .pcConfig = acCfg,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
+        .pszMemoryRequired = NULL,
+        .pcOutString = acOutStr,
+        .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
+        .bValidate = false};
 
-    // Next increment would overflow
-    uint8_t u8Prev = u8Count;
-    u8Count++;
-    TEST_ASSERT_EQUAL(0, u8Count);      // Wrapped to 0
-    TEST_ASSERT_TRUE(u8Count < u8Prev); // Overflow detected
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eInit(au8Memory, sizeof(au8Memory)));
+    TEST_ASSERT_EQUAL(PINCFG_OK_E, PinCfgCsv_eParse(&sParams));
+
+    TEST_ASSERT_EQUAL(PINCFG_CHILD_IDS_MAX_D, psGlobals->u16PresentablesCount);
+    TEST_ASSERT_EQUAL(PINCFG_CHILD_IDS_MAX_D - 1, psGlobals->u16SwitchesCount);
+    TEST_ASSERT_EQUAL(
+        PINCFG_CHILD_IDS_MAX_D - 1, Presentable_u16GetId(psGlobals->ppsPresentables[PINCFG_CHILD_IDS_MAX_D - 1]));
+
+    // one more presentable could be presented but never controlled, the config is rejected
+    sprintf(&acCfg[szLen], "I,i0,2/");
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eInit(au8Memory, sizeof(au8Memory)));
+    TEST_ASSERT_EQUAL(PINCFG_INVALID_FORMAT_E, PinCfgCsv_eParse(&sParams));
+    TEST_ASSERT_EQUAL(MEMORY_OK_E, Memory_eInit(au8Memory, sizeof(au8Memory)));
+    TEST_ASSERT_EQUAL(
+        PINCFG_INVALID_FORMAT_E,
+        PinCfgCsv_eValidate(acCfg, &szMemoryRequired, acOutStr, (uint16_t)OUT_STR_MAX_LEN_D));
+#ifdef PINCFG_USE_ERROR_MESSAGES
+    TEST_ASSERT_NOT_NULL(strstr(acOutStr, "E:L:300:InPin:Too many child ids"));
+#endif
 
-    // This demonstrates the vulnerability - code should check before incrementing
+    Memory_eInit(testMemory, MEMORY_SZ);
 }
 
 /**
- * Test: Loopables count behavior at boundary
+ * Test: Ids past the MySensors child ids are not sent
  */
-void test_vMaxArraySize_LoopablesCount(void)
+void test_vMaxArraySize_ChildIdLimit(void)
 {
-    // Similar to presentables, verify u8LoopablesCount boundary behavior
-    uint8_t u8Count = 255;
-
-    // At max value, any increment would overflow
-    TEST_ASSERT_EQUAL(255, u8Count);
-
-    // Verify array access at boundary is safe
-    // (actual array access testing would require more complex setup)
+    MyMessage sMsg;
+
+    mock_bPresent_bReturn = true;
+    TEST_ASSERT_EQUAL(WRAP_OK_E, ePresent(PINCFG_CHILD_IDS_MAX_D - 1, S_BINARY, "last", false));
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+    TEST_ASSERT_EQUAL(PINCFG_CHILD_IDS_MAX_D - 1, mock_bPresent_u8Id);
+
+    TEST_ASSERT_EQUAL(WRAP_ERROR_E, ePresent(PINCFG_CHILD_IDS_MAX_D, S_BINARY, "far", false));
+    TEST_ASSERT_EQUAL(1, mock_bPresent_u32Called);
+    TEST_ASSERT_EQUAL(WRAP_ERROR_E, eMyMessageInit(&sMsg, 300, V_STATUS, P_BYTE, NULL));
+
+    // incoming messages are addressed by the child id only
+    memset(&sMsg, 0, sizeof(sMsg));
+    sMsg.sensor = 7;
+    sMsg.destination = 3;
+    TEST_ASSERT_EQUAL(7, u16MessageGetSensorId(&sMsg));
 }
 
 /**
@@ -520,8 +506,8 @@ void test_vMalformedCSV_MissingTerminator(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -544,8 +530,8 @@ void test_vMalformedCSV_EmptyFields(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -581,8 +567,8 @@ void test_vMalformedCSV_ExtraFields(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -611,8 +597,8 @@ void test_vMalformedCSV_InvalidNumericChars(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -648,8 +634,8 @@ void test_vMalformedCSV_LongFields(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -680,8 +666,8 @@ void test_vMalformedCSV_UnknownLineType(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -718,8 +704,8 @@ void test_vMalformedCSV_ControlChars(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -857,8 +843,8 @@ void test_vMemoryOverflow_CSVParsing(void)
     size_t szMemoryRequired;
 
     PINCFG_PARSE_PARAMS_T sParams = {
-        .eAddToLoopables = PinCfgCsv_eAddToTempLoopables,
-        .eAddToPresentables = PinCfgCsv_eAddToTempPresentables,
+        .eAddToLoopables = PinCfgCsv_eAddToLoopables,
+        .eAddToPresentables = PinCfgCsv_eAddToPresentables,
         .pszMemoryRequired = &szMemoryRequired,
         .pcOutString = acOutStr,
         .u16OutStrMaxLen = (uint16_t)OUT_STR_MAX_LEN_D,
@@ -907,7 +893,7 @@ void register_stress_tests(void)
     // Array size tests
     RUN_TEST(test_vMaxArraySize_TriggerMaxSwitches);
     RUN_TEST(test_vMaxArraySize_PresentablesCount);
-    RUN_TEST(test_vMaxArraySize_LoopablesCount);
+    RUN_TEST(test_vMaxArraySize_ChildIdLimit);
     RUN_TEST(test_vMaxArraySize_InEventSubscribers);
 
     // Malformed CSV tests